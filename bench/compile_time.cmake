@@ -0,0 +1,69 @@
+# Copyright (C) 2026 by Mark Melton
+#
+# Generate parsers with increasing numbers of options, compile each one and
+# report the compile time and object size.
+#
+# Usage: cmake -DCOMPILER=<c++> -DFLAGS=<a|b> -DINCLUDES=<a|b> -DOUTPUT_DIR=<dir>
+#              -DOPTIONS=<10|100|500> -P compile_time.cmake
+
+# Empty fields, as from an empty CMAKE_CXX_FLAGS, are dropped.
+foreach(VAR FLAGS INCLUDES OPTIONS)
+  string(REGEX REPLACE "^\\|+|\\|+$" "" ${VAR} "${${VAR}}")
+  string(REGEX REPLACE "\\|+" ";" ${VAR} "${${VAR}}")
+endforeach()
+
+set(INCLUDE_FLAGS)
+foreach(DIR ${INCLUDES})
+  list(APPEND INCLUDE_FLAGS "-I${DIR}")
+endforeach()
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+list(JOIN FLAGS " " FLAGS_TEXT)
+message("-- argparse: compiling with ${COMPILER} ${FLAGS_TEXT}")
+
+foreach(N ${OPTIONS})
+  # Short names cycle through the characters without a special meaning to
+  # the parser; once they run out, later options repeat them.
+  set(LINES)
+  set(CODE 1)
+  math(EXPR LAST "${N} - 1")
+  foreach(IDX RANGE ${LAST})
+    if(IDX LESS 3)
+      set(TYPE "argFlag<char(${CODE})>(\"option${IDX}\", \"Option ${IDX}\")")
+    elseif(IDX LESS 6)
+      set(TYPE "argValues<char(${CODE}),std::vector<int>>(\"option${IDX}\", \"Option ${IDX}\")")
+    else()
+      set(TYPE "argValue<char(${CODE}),int>(\"option${IDX}\", \"Option ${IDX}\")")
+    endif()
+    list(APPEND LINES "\t ${TYPE}")
+    math(EXPR CODE "${CODE} % 253 + 1")
+    if(CODE EQUAL 42 OR CODE EQUAL 45)
+      math(EXPR CODE "${CODE} + 1")
+    endif()
+  endforeach()
+  list(JOIN LINES ",\n" OPTION_LINES)
+
+  set(SOURCE ${OUTPUT_DIR}/compile_options_${N}.cpp)
+  set(OBJECT ${OUTPUT_DIR}/compile_options_${N}.o)
+  file(WRITE ${SOURCE}
+    "#include \"core/argparse/argp.h\"\n"
+    "using namespace core::argp::interface;\n"
+    "int run(int argc, const char *argv[])\n"
+    "{\n"
+    "    ArgParse opts\n\t(\n${OPTION_LINES}\n\t);\n"
+    "    opts.parse(argc, argv);\n"
+    "    return opts.get<char(7)>() + opts.get_count<char(1)>();\n"
+    "}\n")
+
+  string(TIMESTAMP START "%s%f" UTC)
+  execute_process(COMMAND ${COMPILER} ${FLAGS} ${INCLUDE_FLAGS} -c ${SOURCE} -o ${OBJECT}
+    RESULT_VARIABLE RESULT)
+  string(TIMESTAMP STOP "%s%f" UTC)
+  if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "argparse: failed to compile ${SOURCE}")
+  endif()
+
+  math(EXPR MILLISECONDS "(${STOP} - ${START}) / 1000")
+  file(SIZE ${OBJECT} BYTES)
+  message("-- argparse: ${N} options: compile ${MILLISECONDS} ms, object ${BYTES} bytes")
+endforeach()
@@ -0,0 +1,56 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/argparse/argp.h"
+
+using namespace core::argp::interface;
+
+static constexpr size_t NumberOptions = 200;
+
+// Short names skip the characters with a special meaning to the parser.
+static constexpr char flag_for(size_t idx)
+{
+    auto c = idx + 1;
+    if (c >= '*') ++c;
+    if (c >= '-') ++c;
+    return static_cast<char>(static_cast<unsigned char>(c));
+}
+
+static const std::vector<std::string> LongNames = []() {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < NumberOptions; ++i)
+	names.push_back("option" + std::to_string(i));
+    return names;
+}();
+
+template<size_t... Is>
+auto make_parser(std::index_sequence<Is...>)
+{ return ArgParse(argValue<flag_for(Is), int>(LongNames[Is], "Benchmark option")...); }
+
+static std::vector<std::string> make_args(size_t stride)
+{
+    std::vector<std::string> args{"program"};
+    for (size_t i = 0; i < NumberOptions; i += stride)
+    {
+	args.push_back("--" + LongNames[NumberOptions - 1 - i]);
+	args.push_back(std::to_string(i));
+    }
+    return args;
+}
+
+static void BM_ParseLarge(benchmark::State& state)
+{
+    auto args = make_args(state.range(0));
+    auto opts = make_parser(std::make_index_sequence<NumberOptions>{});
+    for (auto _ : state)
+    {
+	opts.parse(args);
+	benchmark::DoNotOptimize(opts);
+    }
+    state.SetItemsProcessed(state.iterations() * (args.size() / 2));
+}
+BENCHMARK(BM_ParseLarge)->Arg(1)->Arg(10)->Arg(50);
@@ -0,0 +1,53 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "core/argparse/floating_with_suffix.h"
+#include "core/argparse/list.h"
+
+static std::string make_list(size_t count)
+{
+    std::string input;
+    for (size_t i = 0; i < count; ++i)
+	input += (i > 0 ? "," : "") + std::to_string(0.001 * i * 7919);
+    return input;
+}
+
+// The custom lexical_cast_impl this type replaces: split into substrings,
+// then convert each one.
+static std::vector<double> split_and_convert(std::string_view input)
+{
+    std::vector<double> values;
+    size_t start{0};
+    while (true)
+    {
+	auto pos = input.find(',', start);
+	values.push_back(core::lexical_cast<double>(std::string(input.substr(start, pos - start))));
+	if (pos == std::string_view::npos)
+	    break;
+	start = pos + 1;
+    }
+    return values;
+}
+
+static void BM_SplitAndConvert(benchmark::State& state)
+{
+    auto input = make_list(state.range(0));
+    for (auto _ : state)
+	benchmark::DoNotOptimize(split_and_convert(input));
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_SplitAndConvert)->Arg(100'000);
+
+template<class T>
+static void BM_List(benchmark::State& state)
+{
+    auto input = make_list(state.range(0));
+    for (auto _ : state)
+	benchmark::DoNotOptimize(core::lexical_cast<List<T>>(input));
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_List<double>)->Arg(100'000);
+BENCHMARK(BM_List<FloatingWithSuffix<double>>)->Arg(100'000);
@@ -0,0 +1,76 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "core/argparse/argp.h"
+#include "core/argparse/string_pool.h"
+
+using namespace core::argp::interface;
+
+// Positionals shaped like paths under a few deep directories.
+static std::vector<std::string> make_args(size_t count)
+{
+    std::vector<std::string> args{ "program" };
+    args.reserve(count + 1);
+    for (size_t i = 0; i < count; ++i)
+	args.push_back("/data/project/inputs/shard-" + std::to_string(i % 64)
+		       + "/part-" + std::to_string(i) + ".bin");
+    return args;
+}
+
+// The heap memory of a vector of strings, assuming the short string buffer.
+static size_t bytes(const std::vector<std::string>& strings)
+{
+    size_t total = strings.capacity() * sizeof(std::string);
+    for (const auto& str : strings)
+	if (str.capacity() > 15)
+	    total += str.capacity() + 1;
+    return total;
+}
+
+static size_t bytes(const StringPool& pool)
+{ return pool.bytes(); }
+
+static size_t bytes(const StringTable& table)
+{ return table.bytes(); }
+
+template<class Coll>
+static void BM_ParsePositionals(benchmark::State& state)
+{
+    auto args = make_args(state.range(0));
+    size_t memory{0};
+    for (auto _ : state)
+    {
+	auto opts = ArgParse(argValues<'*',Coll>("files", "Input files"));
+	opts.parse(args);
+	memory = bytes(opts.template get<'*'>());
+	benchmark::DoNotOptimize(opts);
+    }
+    state.counters["bytes"] = memory;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParsePositionals<std::vector<std::string>>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParsePositionals<StringPool>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParsePositionals<StringTable>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+template<class Coll>
+static void BM_IteratePositionals(benchmark::State& state)
+{
+    auto args = make_args(state.range(0));
+    auto opts = ArgParse(argValues<'*',Coll>("files", "Input files"));
+    opts.parse(args);
+    const auto& values = opts.template get<'*'>();
+    for (auto _ : state)
+    {
+	size_t total{0};
+	for (std::string_view value : values)
+	    total += value.size();
+	benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IteratePositionals<std::vector<std::string>>)->Arg(1'000'000);
+BENCHMARK(BM_IteratePositionals<StringPool>)->Arg(1'000'000);
+BENCHMARK(BM_IteratePositionals<StringTable>)->Arg(1'000'000);
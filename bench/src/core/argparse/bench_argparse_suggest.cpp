@@ -0,0 +1,47 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "core/argparse/argp.h"
+#include "core/argparse/detail/suggest.h"
+
+using namespace core::argp::interface;
+
+static std::vector<std::string> make_names(size_t count)
+{
+    std::vector<std::string> names;
+    for (size_t i = 0; i < count; ++i)
+	names.push_back("option-name-" + std::to_string(i * 7919));
+    return names;
+}
+
+static void BM_Suggest(benchmark::State& state)
+{
+    auto names = make_names(state.range(0));
+    std::vector<std::string_view> views(names.begin(), names.end());
+    std::string token(state.range(1), 'o');
+    token.replace(0, std::min(token.size(), names[0].size()), names[0]);
+    token[2] = 'x';
+    for (auto _ : state)
+	benchmark::DoNotOptimize(core::argp::suggest(token, views));
+}
+BENCHMARK(BM_Suggest)->Args({ 10, 12 })->Args({ 500, 12 })->Args({ 500, 64 })->Args({ 500, 4096 });
+
+static void BM_UnknownOption(benchmark::State& state)
+{
+    ArgParse opts
+	(
+	 argFlag<'v'>("verbose", "Verbose diagnostics"),
+	 argValue<'t', int>("threads", "Number of threads"),
+	 argValue<'o', std::string>("output", "Output file")
+	 );
+    std::vector<std::string> args{ "program", "--thread", "4" };
+    for (auto _ : state)
+    {
+	try { opts.parse(args); }
+	catch (const core::argp::unknown_option_error& e) { benchmark::DoNotOptimize(e.suggestions); }
+    }
+}
+BENCHMARK(BM_UnknownOption);
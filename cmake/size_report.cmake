@@ -0,0 +1,28 @@
+# Copyright (C) 2026 by Mark Melton
+#
+# Report the size of the .text section of each executable and their total.
+#
+# Usage: cmake -DSIZE=<size> -DFILES=<a|b> -P size_report.cmake
+
+string(REPLACE "|" ";" FILES "${FILES}")
+
+set(TOTAL 0)
+message("     .text  executable")
+foreach(FILE ${FILES})
+  execute_process(COMMAND ${SIZE} -A ${FILE} OUTPUT_VARIABLE SECTIONS RESULT_VARIABLE RESULT)
+  if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "${SIZE} failed for ${FILE}")
+  endif()
+  string(REGEX MATCH "\n\\.text +([0-9]+)" MATCH "${SECTIONS}")
+  set(TEXT ${CMAKE_MATCH_1})
+  math(EXPR TOTAL "${TOTAL} + ${TEXT}")
+  get_filename_component(NAME ${FILE} NAME)
+  string(LENGTH "${TEXT}" LEN)
+  math(EXPR PAD "10 - ${LEN}")
+  string(REPEAT " " ${PAD} SPACES)
+  message("${SPACES}${TEXT}  ${NAME}")
+endforeach()
+string(LENGTH "${TOTAL}" LEN)
+math(EXPR PAD "10 - ${LEN}")
+string(REPEAT " " ${PAD} SPACES)
+message("${SPACES}${TOTAL}  total")
@@ -10,4 +10,14 @@ using core::argp::ArgParse;
 using core::argp::argFlag;
 using core::argp::argValue;
 using core::argp::argValues;
+using core::argp::argValuesApply;
+using core::argp::argRequires;
+using core::argp::argConflicts;
+using core::argp::argOneOf;
+using core::argp::Discard;
+using core::argp::DumpFormat;
+using core::argp::Glob;
+using core::argp::Limits;
+using core::argp::OptionView;
+using core::argp::ThreadPool;
 };
@@ -0,0 +1,162 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "core/lexical_cast/builtin.h"
+#include "core/lexical_cast/error.h"
+
+namespace core::argp {
+
+/// Bytes given on the command line in a text encoding, such as a key or seed.
+///
+/// The bytes are held in a std::array when the length `N` is fixed and
+/// in a std::vector when it is std::dynamic_extent. A fixed length is
+/// validated when the argument is parsed.
+///
+/// \tparam N The number of bytes, or std::dynamic_extent.
+template<size_t N>
+class Blob {
+public:
+    static constexpr size_t Extent = N;
+    using storage_type = std::conditional_t<N == std::dynamic_extent,
+					    std::vector<std::byte>,
+					    std::array<std::byte, N>>;
+
+    Blob() = default;
+
+    Blob(storage_type bytes)
+	: bytes_(std::move(bytes)) {
+    }
+
+    const std::byte *data() const {
+	return bytes_.data();
+    }
+
+    size_t size() const {
+	return bytes_.size();
+    }
+
+    std::byte operator[](size_t idx) const {
+	return bytes_[idx];
+    }
+
+    auto begin() const {
+	return bytes_.begin();
+    }
+
+    auto end() const {
+	return bytes_.end();
+    }
+
+    std::span<const std::byte, N> span() const {
+	return std::span<const std::byte, N>{bytes_.data(), bytes_.size()};
+    }
+
+    const storage_type& bytes() const {
+	return bytes_;
+    }
+
+    storage_type& bytes() {
+	return bytes_;
+    }
+
+    bool operator==(const Blob& other) const = default;
+
+protected:
+    storage_type bytes_{};
+};
+
+}; // core::argp
+
+/// Bytes given as hex digits, as in `--key 00ff10a7` or `--key 0x00FF10A7`.
+///
+/// \tparam N The number of bytes, or std::dynamic_extent.
+template<size_t N = std::dynamic_extent>
+class Hex : public core::argp::Blob<N> {
+public:
+    using core::argp::Blob<N>::Blob;
+};
+
+/// Bytes given in standard base64 (RFC 4648), with or without padding.
+///
+/// \tparam N The number of bytes, or std::dynamic_extent.
+template<size_t N = std::dynamic_extent>
+class Base64 : public core::argp::Blob<N> {
+public:
+    using core::argp::Blob<N>::Blob;
+};
+
+namespace core::lexical_cast_detail {
+
+/// Decode the hex digits `s` into the `s.size() / 2` bytes at `out`.
+///
+/// \returns False if `s` has a character that is not a hex digit.
+bool decode_hex(std::string_view s, std::byte *out);
+
+/// The lowercase hex digits of `bytes`.
+std::string encode_hex(std::span<const std::byte> bytes);
+
+/// The number of bytes base64 `s` decodes to, or nothing if its length
+/// or padding is invalid.
+std::optional<size_t> base64_size(std::string_view s);
+
+/// Decode base64 `s` into the base64_size(s) bytes at `out`.
+///
+/// \returns False if `s` has a character outside the alphabet or
+/// nonzero bits after the last byte.
+bool decode_base64(std::string_view s, std::byte *out);
+
+/// The padded base64 encoding of `bytes`.
+std::string encode_base64(std::span<const std::byte> bytes);
+
+template<size_t N>
+struct lexical_cast_impl<Hex<N>> {
+    Hex<N> convert(std::string_view s) const {
+	auto digits = s;
+	if (digits.size() >= 2 and digits[0] == '0' and (digits[1] == 'x' or digits[1] == 'X'))
+	    digits.remove_prefix(2);
+
+	if (digits.size() % 2 != 0 or (N != std::dynamic_extent and digits.size() != 2 * N))
+	    throw lexical_cast_error(s, "Hex");
+
+	Hex<N> r;
+	if constexpr (N == std::dynamic_extent)
+	    r.bytes().resize(digits.size() / 2);
+	if (not decode_hex(digits, r.bytes().data()))
+	    throw lexical_cast_error(s, "Hex");
+	return r;
+    }
+
+    std::string to_string(const Hex<N>& value) const {
+	return encode_hex(value.span());
+    }
+};
+
+template<size_t N>
+struct lexical_cast_impl<Base64<N>> {
+    Base64<N> convert(std::string_view s) const {
+	auto size = base64_size(s);
+	if (not size or (N != std::dynamic_extent and *size != N))
+	    throw lexical_cast_error(s, "Base64");
+
+	Base64<N> r;
+	if constexpr (N == std::dynamic_extent)
+	    r.bytes().resize(*size);
+	if (not decode_base64(s, r.bytes().data()))
+	    throw lexical_cast_error(s, "Base64");
+	return r;
+    }
+
+    std::string to_string(const Base64<N>& value) const {
+	return encode_base64(value.span());
+    }
+};
+
+};
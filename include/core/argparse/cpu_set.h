@@ -0,0 +1,278 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <bitset>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <thread>
+#include <sched.h>
+#include "core/lexical_cast/integral.h"
+#include "core/lexical_cast/error.h"
+
+namespace core::argp {
+
+/// A set of small non-negative ids held in a fixed-size bitset.
+///
+/// On the command line an id set is a comma separated list of items,
+/// where each item is a single id `a`, an inclusive range `a-b` or an
+/// inclusive strided range `a-b:s`, as in `0-7,16-23`. This is the
+/// syntax of the Linux cpulist files.
+template<size_t N>
+class IdSet {
+public:
+    static constexpr size_t Capacity = N;
+    
+    class iterator {
+    public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = size_t;
+
+	iterator() = default;
+	
+	iterator(const std::bitset<N> *bits, size_t id)
+	    : bits_(bits)
+	    , id_(id) {
+	    skip();
+	}
+
+	size_t operator*() const {
+	    return id_;
+	}
+
+	iterator& operator++() {
+	    ++id_;
+	    skip();
+	    return *this;
+	}
+
+	iterator operator++(int) {
+	    auto r = *this;
+	    ++*this;
+	    return r;
+	}
+
+	bool operator==(const iterator& other) const {
+	    return id_ == other.id_;
+	}
+
+    private:
+	void skip() {
+	    while (id_ < N and not bits_->test(id_))
+		++id_;
+	}
+	
+	const std::bitset<N> *bits_{nullptr};
+	size_t id_{N};
+    };
+    
+    IdSet() = default;
+
+    IdSet(std::initializer_list<size_t> ids) {
+	for (auto id : ids)
+	    insert(id);
+    }
+
+    /// Add `id`, throwing std::out_of_range if it is not below the capacity.
+    void insert(size_t id) {
+	bits_.set(id);
+    }
+
+    bool contains(size_t id) const {
+	return id < N and bits_.test(id);
+    }
+
+    size_t size() const {
+	return bits_.count();
+    }
+
+    bool empty() const {
+	return bits_.none();
+    }
+
+    /// The `idx`th smallest id.
+    size_t operator[](size_t idx) const {
+	auto iter = begin();
+	std::advance(iter, idx);
+	return *iter;
+    }
+
+    iterator begin() const {
+	return iterator{&bits_, 0};
+    }
+
+    iterator end() const {
+	return iterator{&bits_, N};
+    }
+
+    const std::bitset<N>& bits() const {
+	return bits_;
+    }
+
+    bool is_subset_of(const IdSet& other) const {
+	return (bits_ & ~other.bits_).none();
+    }
+
+    bool operator==(const IdSet& other) const = default;
+
+protected:
+    std::bitset<N> bits_;
+};
+
+}; // core::argp
+
+/// A set of CPUs, such as the argument of `--cpus 0-7,16-23`.
+///
+/// Parsing rejects CPUs outside the affinity mask of the process.
+class CpuSet : public core::argp::IdSet<CPU_SETSIZE> {
+public:
+    using IdSet::IdSet;
+
+    CpuSet() = default;
+    
+    CpuSet(const IdSet& ids)
+	: IdSet(ids) {
+    }
+
+    /// The CPUs this process may run on, from sched_getaffinity.
+    static CpuSet available();
+
+    /// The set as a cpu_set_t for use with the scheduling interfaces.
+    cpu_set_t native() const;
+
+    /// Restrict the calling thread to the CPUs of this set, throwing
+    /// std::system_error on failure.
+    void pin() const;
+
+    /// Restrict the calling thread to the `idx`th CPU of this set, wrapping
+    /// around when there are more threads than CPUs. Calling this with the
+    /// worker index from each thread of a pool spreads the pool across the
+    /// set.
+    void pin(size_t idx) const;
+
+    /// Restrict each of `threads` to one CPU of this set in turn.
+    void spread(std::span<std::thread> threads) const;
+};
+
+/// A set of NUMA nodes, such as the argument of `--numa 0,1`.
+///
+/// Parsing rejects nodes that are not listed as online under
+/// /sys/devices/system/node.
+class NumaSet : public core::argp::IdSet<1024> {
+public:
+    using IdSet::IdSet;
+
+    NumaSet() = default;
+    
+    NumaSet(const IdSet& ids)
+	: IdSet(ids) {
+    }
+
+    /// The online NUMA nodes. Systems without NUMA support report node 0.
+    static NumaSet online();
+
+    /// The CPUs belonging to the nodes of this set.
+    CpuSet cpus() const;
+
+    /// Restrict the calling thread to the CPUs of the nodes of this set.
+    void pin() const {
+	cpus().pin();
+    }
+
+    /// Restrict the calling thread to the `idx`th CPU of the nodes of this set.
+    void pin(size_t idx) const {
+	cpus().pin(idx);
+    }
+};
+
+namespace core::lexical_cast_detail {
+
+/// Parse the list and range syntax of IdSet into `Set`.
+template<class Set>
+Set parse_id_set(std::string_view s, const char *name) {
+    core::argp::IdSet<Set::Capacity> ids;
+    auto parse = [&](const char *begin, const char *end, size_t& value) {
+	auto r = std::from_chars(begin, end, value);
+	if (r.ec != std::errc{})
+	    throw lexical_cast_error(s, name);
+	return r.ptr;
+    };
+    
+    const char *ptr = s.begin(), *end = s.end();
+    while (true) {
+	size_t start{}, stop{}, step{1};
+	ptr = parse(ptr, end, start);
+	stop = start;
+	if (ptr != end and *ptr == '-')
+	    ptr = parse(ptr + 1, end, stop);
+	if (ptr != end and *ptr == ':')
+	    ptr = parse(ptr + 1, end, step);
+	if (stop < start or step == 0 or stop >= Set::Capacity)
+	    throw lexical_cast_error(s, name);
+	// Stop before the step passes `stop`, since `id += step` can wrap.
+	for (auto id = start; ; id += step) {
+	    ids.insert(id);
+	    if (stop - id < step)
+		break;
+	}
+
+	if (ptr == end)
+	    break;
+	if (*ptr != ',')
+	    throw lexical_cast_error(s, name);
+	++ptr;
+    }
+    return Set{ids};
+}
+
+/// Format an IdSet in the compressed list and range syntax.
+template<size_t N>
+std::string id_set_to_string(const core::argp::IdSet<N>& ids) {
+    std::string r;
+    for (auto iter = ids.begin(); iter != ids.end(); ) {
+	auto start = *iter, stop = start;
+	while (++iter != ids.end() and *iter == stop + 1)
+	    ++stop;
+	if (not r.empty()) r += ",";
+	r += lexical_to_string(start);
+	if (stop > start)
+	    r += "-" + lexical_to_string(stop);
+    }
+    return r;
+}
+
+template<>
+struct lexical_cast_impl<CpuSet> {
+    CpuSet convert(std::string_view s) const {
+	auto set = parse_id_set<CpuSet>(s, "CpuSet");
+	if (not set.is_subset_of(CpuSet::available()))
+	    throw lexical_cast_error(s, "CpuSet");
+	return set;
+    }
+
+    std::string to_string(const CpuSet& value) const {
+	return id_set_to_string(value);
+    }
+};
+
+template<>
+struct lexical_cast_impl<NumaSet> {
+    NumaSet convert(std::string_view s) const {
+	auto set = parse_id_set<NumaSet>(s, "NumaSet");
+	if (not set.is_subset_of(NumaSet::online()))
+	    throw lexical_cast_error(s, "NumaSet");
+	return set;
+    }
+
+    std::string to_string(const NumaSet& value) const {
+	return id_set_to_string(value);
+    }
+};
+
+};
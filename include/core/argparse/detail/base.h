@@ -9,6 +9,7 @@ namespace core::argp
 {
 
 static constexpr char OptionSymbol = '-';
+static constexpr char ValueSymbol = '=';
 
 bool is_identifier(char c);
 bool is_long_option(std::string_view arg);
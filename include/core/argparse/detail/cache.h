@@ -0,0 +1,227 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "container.h"
+
+namespace core::argp
+{
+
+class MappedFile;
+
+/// The key identifying cached parse results: a hash of the argument tokens, the
+/// modification time and size of each dependency and the option signature.
+uint64_t cache_key(std::span<const std::string> args,
+		   std::span<const std::string> dependencies,
+		   std::string_view signature);
+
+/// Accumulates serialized option values for the parse cache.
+class CacheWriter
+{
+public:
+    void write(const void *data, size_t size)
+    { m_buffer.append(static_cast<const char*>(data), size); }
+
+    /// Atomically replace the cache file at `path`, returning false on failure.
+    bool commit(const std::string& path, uint64_t key) const;
+
+private:
+    std::string m_buffer;
+};
+
+/// Reads serialized option values from a memory mapped cache file.
+class CacheReader
+{
+public:
+    CacheReader();
+    ~CacheReader();
+    
+    /// Map the cache file at `path`, returning false unless it exists, has the
+    /// current format and was written with `key`.
+    bool open(const std::string& path, uint64_t key);
+
+    bool read(void *data, size_t size)
+    {
+	if (size > m_payload.size())
+	    return false;
+	std::memcpy(data, m_payload.data(), size);
+	m_payload = m_payload.subspan(size);
+	return true;
+    }
+
+    /// Take the next `size` bytes in place, without copying them. The view
+    /// refers to the mapped file, so it is only valid while the reader is.
+    bool read_view(std::string_view& view, size_t size)
+    {
+	if (size > m_payload.size())
+	    return false;
+	view = std::string_view(reinterpret_cast<const char*>(m_payload.data()), size);
+	m_payload = m_payload.subspan(size);
+	return true;
+    }
+
+    bool done() const
+    { return m_payload.empty(); }
+
+    /// The number of bytes left to read, which bounds any count read from
+    /// the file before it is used to size a value.
+    size_t remaining() const
+    { return m_payload.size(); }
+
+private:
+    std::unique_ptr<MappedFile> m_file;
+    std::span<const std::byte> m_payload;
+};
+
+/// Describes how an option value is stored in the parse cache.
+///
+/// Trivially copyable values are stored as their bytes, strings and
+/// contiguous containers of trivially copyable values as a length and a
+/// single block of bytes, and other containers element by element.
+///
+/// \tparam T The value type.
+template<class T>
+struct cache_traits;
+
+template<class T>
+concept cacheable = requires (CacheWriter& w, CacheReader& r, const T& cv, T& v) {
+    cache_traits<T>::save(w, cv);
+    { cache_traits<T>::load(r, v) } -> std::same_as<bool>;
+};
+
+template<class T>
+requires std::is_trivially_copyable_v<T>
+struct cache_traits<T>
+{
+    static void save(CacheWriter& w, const T& value)
+    { w.write(&value, sizeof(T)); }
+
+    static bool load(CacheReader& r, T& value)
+    { return r.read(&value, sizeof(T)); }
+};
+
+template<class C>
+concept contiguous_trivial = std::is_trivially_copyable_v<typename C::value_type>
+    and requires (C& c, size_t n) { c.data(); c.resize(n); };
+
+template<class C>
+requires (not std::is_trivially_copyable_v<C>) and contiguous_trivial<C>
+struct cache_traits<C>
+{
+    static void save(CacheWriter& w, const C& value)
+    {
+	uint64_t size = value.size();
+	w.write(&size, sizeof(size));
+	w.write(value.data(), size * sizeof(typename C::value_type));
+    }
+
+    static bool load(CacheReader& r, C& value)
+    {
+	uint64_t size{};
+	if (not r.read(&size, sizeof(size)) or size > r.remaining() / sizeof(typename C::value_type))
+	    return false;
+	value.resize(size);
+	return r.read(value.data(), size * sizeof(typename C::value_type));
+    }
+};
+
+template<class C>
+concept insertable = fixed_size<C>::value or set_container<C> or map_container<C>
+    or requires (C& c, container_element_t<C> e) { c.emplace_back(std::move(e)); };
+
+template<class C>
+requires (not std::is_trivially_copyable_v<C>) and (not contiguous_trivial<C>)
+    and requires { typename C::value_type; }
+    and insertable<C> and cacheable<container_element_t<C>>
+struct cache_traits<C>
+{
+    using Element = container_element_t<C>;
+    
+    static void save(CacheWriter& w, const C& value)
+    {
+	uint64_t size = value.size();
+	w.write(&size, sizeof(size));
+	for (const auto& elem : value)
+	    cache_traits<Element>::save(w, Element(elem));
+    }
+
+    static bool load(CacheReader& r, C& value)
+    {
+	// Every element takes at least one byte.
+	uint64_t size{};
+	if (not r.read(&size, sizeof(size)) or size > r.remaining())
+	    return false;
+	
+	value = C{};
+	Inserter<C> inserter(value, size);
+	for (uint64_t i = 0; i < size; ++i)
+	{
+	    Element elem{};
+	    if (not cache_traits<Element>::load(r, elem))
+		return false;
+	    inserter.add(std::move(elem));
+	}
+	inserter.finish();
+	return true;
+    }
+};
+
+template<class K, class V>
+requires (not std::is_trivially_copyable_v<std::pair<K,V>>) and cacheable<K> and cacheable<V>
+struct cache_traits<std::pair<K,V>>
+{
+    static void save(CacheWriter& w, const std::pair<K,V>& value)
+    {
+	cache_traits<K>::save(w, value.first);
+	cache_traits<V>::save(w, value.second);
+    }
+
+    static bool load(CacheReader& r, std::pair<K,V>& value)
+    { return cache_traits<K>::load(r, value.first) and cache_traits<V>::load(r, value.second); }
+};
+
+// A view refers to memory that does not survive the process.
+template<>
+struct cache_traits<std::string_view>
+{ };
+
+// The values of a Discard container are gone, so they cannot be cached.
+template<class T>
+struct cache_traits<Discard<T>>
+{ };
+
+template<class T>
+requires (not std::is_trivially_copyable_v<std::optional<T>>) and cacheable<T>
+struct cache_traits<std::optional<T>>
+{
+    static void save(CacheWriter& w, const std::optional<T>& value)
+    {
+	bool engaged = value.has_value();
+	w.write(&engaged, sizeof(engaged));
+	if (engaged)
+	    cache_traits<T>::save(w, *value);
+    }
+
+    static bool load(CacheReader& r, std::optional<T>& value)
+    {
+	bool engaged{};
+	if (not r.read(&engaged, sizeof(engaged)))
+	    return false;
+	if (not engaged)
+	{
+	    value.reset();
+	    return true;
+	}
+	value.emplace();
+	return cache_traits<T>::load(r, *value);
+    }
+};
+
+}; // core::argp
@@ -0,0 +1,53 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <type_traits>
+
+namespace core::argp
+{
+
+enum class ConstraintKind { Requires, Conflicts, OneOf };
+
+/// Describes a relationship between options that is checked after parsing.
+///
+/// \tparam K The kind of constraint.
+/// \tparam Cs The single character names of the constrained options.
+template<ConstraintKind K, char... Cs>
+struct Constraint
+{
+    static constexpr ConstraintKind Kind = K;
+};
+
+template<class T>
+struct is_constraint : std::false_type { };
+
+template<ConstraintKind K, char... Cs>
+struct is_constraint<Constraint<K, Cs...>> : std::true_type { };
+
+template<class T>
+constexpr bool is_constraint_v = is_constraint<T>::value;
+
+/// Construct a constraint requiring options `Bs` whenever option `A` is present.
+///
+/// \tparam A The single character name of the requiring option.
+/// \tparam Bs The single character names of the required options.
+template<char A, char... Bs>
+constexpr auto argRequires()
+{ return Constraint<ConstraintKind::Requires, A, Bs...>{}; }
+
+/// Construct a constraint allowing at most one of options `Cs` to be present.
+///
+/// \tparam Cs The single character names of the conflicting options.
+template<char... Cs>
+constexpr auto argConflicts()
+{ return Constraint<ConstraintKind::Conflicts, Cs...>{}; }
+
+/// Construct a constraint requiring exactly one of options `Cs` to be present.
+///
+/// \tparam Cs The single character names of the alternative options.
+template<char... Cs>
+constexpr auto argOneOf()
+{ return Constraint<ConstraintKind::OneOf, Cs...>{}; }
+
+}; // core::argp
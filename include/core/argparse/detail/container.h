@@ -0,0 +1,241 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "base.h"
+#include "core/lexical_cast/builtin.h"
+#include "core/lexical_cast/error.h"
+
+namespace core::argp
+{
+
+/// A container that associates keys with values, such as std::map or std::flat_map.
+template<class C>
+concept map_container = requires { typename C::key_type; typename C::mapped_type; };
+
+/// A container of unique or ordered keys, such as std::set or std::unordered_set.
+template<class C>
+concept set_container = requires { typename C::key_type; } and not map_container<C>;
+
+/// A container that only counts its values.
+///
+/// Options that consume their values in a functor as they arrive, such
+/// as a stream of paths fed to ArgParse::Feeder, use it to run in
+/// constant memory.
+///
+/// \tparam T The value type.
+template<class T>
+class Discard
+{
+public:
+    using value_type = T;
+
+    template<class U>
+    void emplace_back(U&&)
+    { ++m_size; }
+
+    size_t size() const
+    { return m_size; }
+
+    bool empty() const
+    { return m_size == 0; }
+
+    const T *begin() const
+    { return nullptr; }
+
+    const T *end() const
+    { return nullptr; }
+
+    bool operator==(const Discard&) const = default;
+
+private:
+    size_t m_size{0};
+};
+
+/// Customizes how ArgValues converts a run of values of type `T`.
+///
+/// When enabled, ArgValues starts a batch for all of the tokens of an
+/// occurrence before converting the first one, then converts each token
+/// from the batch in order, so errors still refer to the exact token.
+///
+/// \tparam T The value type.
+template<class T>
+struct prefetch_traits
+{
+    static constexpr bool Enabled = false;
+};
+
+template<class C>
+struct fixed_size : std::false_type { };
+
+template<class T, size_t N>
+struct fixed_size<std::array<T,N>> : std::true_type { };
+
+/// Describes how command line tokens are converted and collected into a container.
+///
+/// Sequences are reserved once for all of the values of an occurrence and
+/// filled with emplace_back. Set and map containers collect the values of
+/// an occurrence and insert them in bulk, so ordering and deduplication
+/// happen once. Map containers take `key=value` tokens and the last value
+/// given for a key wins, as with repeated `-D` definitions. A std::array is
+/// filled in place and must receive exactly as many values as it holds.
+///
+/// \tparam C The container type.
+template<class C>
+struct container_traits
+{
+    using element_type = typename C::value_type;
+    static constexpr size_t Min = 1;
+    static constexpr size_t Max = std::numeric_limits<size_t>::max();
+
+    static element_type convert(std::string_view input)
+    { return core::lexical_cast<element_type>(input); }
+};
+
+template<map_container C>
+struct container_traits<C>
+{
+    using element_type = std::pair<typename C::key_type, typename C::mapped_type>;
+    static constexpr size_t Min = 1;
+    static constexpr size_t Max = std::numeric_limits<size_t>::max();
+
+    static element_type convert(std::string_view input)
+    {
+	auto pos = input.find(ValueSymbol);
+	if (pos == std::string_view::npos)
+	    throw core::lexical_cast_error(input, "key=value");
+	return { core::lexical_cast<typename C::key_type>(input.substr(0, pos)),
+		 core::lexical_cast<typename C::mapped_type>(input.substr(pos + 1)) };
+    }
+};
+
+template<class T, size_t N>
+struct container_traits<std::array<T,N>>
+{
+    using element_type = T;
+    static constexpr size_t Min = N;
+    static constexpr size_t Max = N;
+
+    static element_type convert(std::string_view input)
+    { return core::lexical_cast<element_type>(input); }
+};
+
+template<class C>
+using container_element_t = typename container_traits<C>::element_type;
+
+/// Collects the values of one occurrence of an option into a container.
+///
+/// \tparam C The container type.
+template<class C>
+class Inserter
+{
+public:
+    Inserter(C& container, size_t expected)
+	: m_container(container)
+    {
+	if constexpr (requires { container.reserve(expected); })
+	    container.reserve(container.size() + expected);
+    }
+
+    template<class T>
+    void add(T&& value)
+    { m_container.emplace_back(std::forward<T>(value)); }
+
+    void finish() { }
+
+    size_t count() const
+    { return m_container.size(); }
+
+    /// The count once `value` is added.
+    template<class T>
+    size_t count_with(const T&)
+    { return count() + 1; }
+
+private:
+    C& m_container;
+};
+
+template<class C>
+requires set_container<C> or map_container<C>
+class Inserter<C>
+{
+public:
+    Inserter(C& container, size_t expected)
+	: m_container(container)
+    { m_pending.reserve(expected); }
+
+    template<class T>
+    void add(T&& value)
+    { m_pending.emplace_back(std::forward<T>(value)); }
+
+    void finish()
+    {
+	if constexpr (requires { m_container.insert_or_assign(std::move(m_pending.front().first),
+							       std::move(m_pending.front().second)); })
+	{
+	    for (auto& [key, value] : m_pending)
+		m_container.insert_or_assign(std::move(key), std::move(value));
+	}
+	else
+	    m_container.insert(std::make_move_iterator(m_pending.begin()),
+			       std::make_move_iterator(m_pending.end()));
+	m_pending.clear();
+    }
+
+    size_t count() const
+    { return m_container.size() + m_pending.size(); }
+
+    /// The count once `value` is added, which settles the pending values
+    /// first so that a repeated key is not counted again.
+    template<class T>
+    size_t count_with(const T& value)
+    {
+	finish();
+	if constexpr (not requires { m_container.insert(value).second; })
+	    return count() + 1;
+	else if constexpr (map_container<C>)
+	    return count() + (m_container.contains(value.first) ? 0 : 1);
+	else
+	    return count() + (m_container.contains(value) ? 0 : 1);
+    }
+
+private:
+    C& m_container;
+    std::vector<container_element_t<C>> m_pending;
+};
+
+template<class T, size_t N>
+class Inserter<std::array<T,N>>
+{
+public:
+    Inserter(std::array<T,N>& container, size_t)
+	: m_container(container)
+    { }
+
+    template<class U>
+    void add(U&& value)
+    {
+	if (m_count < N)
+	    m_container[m_count] = std::forward<U>(value);
+	++m_count;
+    }
+
+    void finish() { }
+
+    size_t count() const
+    { return m_count; }
+
+    template<class U>
+    size_t count_with(const U&)
+    { return m_count + 1; }
+
+private:
+    std::array<T,N>& m_container;
+    size_t m_count{0};
+};
+
+}; // core::argp
@@ -2,27 +2,60 @@
 //
 
 #pragma once
+#include <array>
+#include <span>
 #include "base.h"
+#include "limits.h"
 
 namespace core::argp
 {
 
+/// The option index of each flag character, or -1 when there is none.
+using FlagTable = std::array<int, 256>;
+
 class Context
 {
 public:
-    Context(const std::vector<std::string>& args);
+    /// Construct a context over `args`, whose first token is the program name.
+    ///
+    /// \param args The tokens.
+    /// \param limits The limits enforced while the tokens are consumed.
+    /// \param flags The flags of the parser, so that a group such as
+    /// `-n5` that starts with one of them ends a list of values.
+    Context(const std::vector<std::string>& args, const Limits& limits = {},
+	    const FlagTable *flags = nullptr);
+
+    /// Make `token` the only token, reusing the existing storage. The
+    /// assigned tokens count toward the token and byte limits.
+    void assign(std::string_view token);
 
     bool end() const;
     std::string_view front() const;
     void pop();
 
+    /// Return true if `token` ends a list of values: an option, the
+    /// option separator or a group that starts with a known flag.
+    bool ends_values(std::string_view token) const;
+
+    /// The number of tokens before the next token that ends the values.
+    size_t count_values() const;
+
+    /// The next `count` tokens, which must exist.
+    std::span<const std::string> peek(size_t count) const;
+
     const std::vector<std::string>& tokens() const;
+    const Limits& limits() const;
     std::string canonical_line() const;
     std::string canonical_marker() const;
     
 private:
+    void tick();
+    
     size_t m_index;
     std::vector<std::string> m_tokens;
+    Limits m_limits;
+    const FlagTable *m_flags;
+    size_t m_ticks{0}, m_assigned{0}, m_assigned_bytes{0};
 };
 
 }; // core::argp
@@ -0,0 +1,135 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "state.h"
+#include "core/lexical_cast/builtin.h"
+#include "core/mp/type_name.h"
+
+namespace core::argp
+{
+
+/// The output format of ArgParse::dump.
+enum class DumpFormat
+{
+    /// A compact JSON object with a member per option.
+    Json,
+
+    /// A line per option of space separated `key=value` fields.
+    KeyValue
+};
+
+/// The text form of `origin` used by ArgParse::dump.
+std::string_view origin_name(Origin origin);
+
+/// Writes text into a caller-provided buffer without allocating.
+///
+/// Like snprintf, the writer keeps counting once the buffer is full, so
+/// size() is the length the complete text needs.
+class DumpWriter
+{
+public:
+    DumpWriter(std::span<char> buffer)
+	: m_buffer(buffer)
+    { }
+
+    void put(char c)
+    {
+	if (m_size < m_buffer.size())
+	    m_buffer[m_size] = c;
+	++m_size;
+    }
+
+    void put(std::string_view text)
+    {
+	if (m_size < m_buffer.size())
+	    std::memcpy(m_buffer.data() + m_size, text.data(), std::min(text.size(), m_buffer.size() - m_size));
+	m_size += text.size();
+    }
+
+    /// Write `value` with std::to_chars, so floating values round trip.
+    template<class T>
+    void number(T value)
+    {
+	char digits[64];
+	auto r = std::to_chars(digits, digits + sizeof(digits), value);
+	put(std::string_view(digits, r.ptr));
+    }
+
+    /// Write `text` as a JSON string, or bare in key=value output unless
+    /// it is empty or holds a space, quote, backslash, comma, equals sign,
+    /// colon or newline.
+    void string(std::string_view text, DumpFormat format);
+
+    size_t size() const
+    { return m_size; }
+
+private:
+    std::span<char> m_buffer;
+    size_t m_size{0};
+};
+
+/// Write the value of an option.
+///
+/// Numbers and strings are written directly, standard containers as JSON
+/// arrays or comma separated lists and pairs as `[key,value]` or
+/// `key:value`. Other types with a lexical_cast are written as strings
+/// through lexical_to_string, which may allocate.
+template<class T>
+void dump_value(DumpWriter& out, const T& value, DumpFormat format)
+{
+    if constexpr (std::is_convertible_v<const T&, std::string_view>)
+	out.string(std::string_view(value), format);
+    else if constexpr (std::is_same_v<T, bool>)
+	out.put(value ? "true" : "false");
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+	if (format == DumpFormat::Json and not std::isfinite(value))
+	    out.put(std::isnan(value) ? "\"nan\"" : value > 0 ? "\"inf\"" : "\"-inf\"");
+	else
+	    out.number(value);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+	out.number(value);
+    else if constexpr (requires { value.has_value(); *value; })
+    {
+	if (value.has_value()) dump_value(out, *value, format);
+	else if (format == DumpFormat::Json) out.put("null");
+    }
+    else if constexpr (requires { value.first; value.second; })
+    {
+	out.put(format == DumpFormat::Json ? "[" : "");
+	dump_value(out, value.first, format);
+	out.put(format == DumpFormat::Json ? ',' : ':');
+	dump_value(out, value.second, format);
+	out.put(format == DumpFormat::Json ? "]" : "");
+    }
+    else if constexpr (requires { typename T::allocator_type; value.begin(); } or
+		       (not requires { core::lexical_cast_detail::lexical_cast_impl<T>{}.to_string(value); }
+			and requires { value.begin(); value.end(); }))
+    {
+	if (format == DumpFormat::Json) out.put('[');
+	bool first{true};
+	for (const auto& elem : value)
+	{
+	    if (not std::exchange(first, false))
+		out.put(',');
+	    dump_value(out, elem, format);
+	}
+	if (format == DumpFormat::Json) out.put(']');
+    }
+    else if constexpr (requires { core::lexical_cast_detail::lexical_cast_impl<T>{}.to_string(value); })
+	out.string(core::lexical_to_string(value), format);
+    else
+	out.string(core::mp::type_name<T>(), format);
+}
+
+}; // core::argp
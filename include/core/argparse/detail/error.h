@@ -2,7 +2,10 @@
 //
 
 #pragma once
+#include <span>
+#include <stdexcept>
 #include <typeinfo>
+#include <vector>
 #include "context.h"
 
 namespace core::argp
@@ -29,7 +32,9 @@ struct error_count : public error_type
 
 struct unknown_option_error : public error
 {
-    unknown_option_error(std::string_view name, const Context& ctx);
+    unknown_option_error(std::string_view name, const Context& ctx,
+			 std::vector<std::string> arg_suggestions = {});
+    std::vector<std::string> suggestions;
 };
 
 struct missing_value_error : public error_type
@@ -37,9 +42,16 @@ struct missing_value_error : public error_type
     missing_value_error(std::string_view name, const Context& ctx, const std::type_info& type);
 };
 
+struct unexpected_value_error : public error
+{
+    unexpected_value_error(std::string_view name, std::string_view value, const Context& ctx);
+};
+
 struct bad_value_error : public error_type
 {
     bad_value_error(std::string_view name, const Context& ctx, const std::type_info& type);
+    bad_value_error(std::string_view name, std::string_view input, const Context& ctx,
+		    const std::type_info& type);
 };
 
 struct too_few_values_error : public error_count
@@ -54,4 +66,113 @@ struct too_many_values_error : public error_count
 			  size_t arg_number_found, size_t arg_number_max);
 };
 
+/// Raised when parsing exceeds one of the Limits.
+struct limit_error : public error
+{
+    limit_error(std::string_view msg, const Context& ctx);
+};
+
+/// Raised when parsing exceeds a Limits bound on an amount.
+struct limit_count_error : public limit_error
+{
+    limit_count_error(std::string_view msg, const Context& ctx,
+		      size_t arg_number_found, size_t arg_number_limit);
+    size_t number_found, number_limit;
+};
+
+struct token_limit_error : public limit_count_error
+{
+    token_limit_error(const Context& ctx, size_t number_found, size_t number_limit);
+};
+
+struct byte_limit_error : public limit_count_error
+{
+    byte_limit_error(const Context& ctx, size_t number_found, size_t number_limit);
+};
+
+struct group_limit_error : public limit_count_error
+{
+    group_limit_error(std::string_view group, const Context& ctx,
+		      size_t number_found, size_t number_limit);
+};
+
+struct value_limit_error : public limit_count_error
+{
+    value_limit_error(std::string_view name, const Context& ctx,
+		      size_t number_found, size_t number_limit);
+};
+
+struct deadline_error : public limit_error
+{
+    deadline_error(const Context& ctx);
+};
+
+/// Raised when a glob pattern matches nothing or cannot be expanded.
+struct glob_error : public error
+{
+    glob_error(std::string_view msg, const Context& ctx);
+};
+
+struct constraint_error : public error
+{
+    constraint_error(std::string_view msg, const Context& ctx);
+};
+
+struct requires_error : public constraint_error
+{
+    requires_error(std::string_view name, std::string_view required, const Context& ctx);
+};
+
+struct conflicts_error : public constraint_error
+{
+    conflicts_error(std::string_view name, std::string_view other, const Context& ctx);
+};
+
+struct one_of_error : public constraint_error
+{
+    one_of_error(std::string_view names, size_t number_found, const Context& ctx);
+};
+
+/// Raised when an option stored in a struct member is used before
+/// ArgParse::bind supplied the struct.
+struct unbound_error : public std::logic_error
+{
+    unbound_error(const std::type_info& type);
+};
+
+// The throw sites of the option and parser templates call these instead
+// of throwing directly, so the code that builds and throws each error is
+// compiled once into the library, away from the parse loop.
+
+/// Throw unknown_option_error for `token`, suggesting similar long names.
+[[noreturn, gnu::cold]]
+void throw_unknown_option(std::string_view token, const Context& ctx,
+			  std::span<const std::string_view> long_names = {});
+
+/// Throw unknown_option_error for the flag `c` of an option group.
+[[noreturn, gnu::cold]]
+void throw_unknown_flag(char c, const Context& ctx);
+
+[[noreturn, gnu::cold]]
+void throw_unexpected_value(std::string_view name, std::string_view value, const Context& ctx);
+
+[[noreturn, gnu::cold]]
+void throw_missing_value(std::string_view name, const Context& ctx, const std::type_info& type);
+
+[[noreturn, gnu::cold]]
+void throw_bad_value(std::string_view name, std::string_view input, const Context& ctx,
+		     const std::type_info& type);
+
+/// Throw too_few_values_error if `count` is below `min`, too_many_values_error
+/// if it is above `max` and otherwise value_limit_error for `limit`.
+[[noreturn, gnu::cold]]
+void throw_value_count(std::string_view name, const Context& ctx, const std::type_info& type,
+		       size_t count, size_t min, size_t max, size_t limit);
+
+[[noreturn, gnu::cold]]
+void throw_group_limit(std::string_view group, const Context& ctx, size_t limit);
+
+[[noreturn, gnu::cold]]
+void throw_unbound(const std::type_info& type);
+
 }; // core::argp
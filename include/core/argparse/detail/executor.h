@@ -0,0 +1,105 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace core::argp
+{
+
+/// Runs a task, perhaps on another thread.
+using Executor = std::function<void(std::function<void()>)>;
+
+/// A fixed set of worker threads sharing one task queue.
+class ThreadPool
+{
+public:
+    /// Start `nthreads` workers.
+    ThreadPool(size_t nthreads = std::thread::hardware_concurrency());
+
+    /// Finish the queued tasks and join the workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void post(std::function<void()> task);
+
+    /// An Executor that posts to this pool.
+    Executor executor()
+    { return [this](std::function<void()> task) { post(std::move(task)); }; }
+
+private:
+    void work();
+    
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_threads;
+    bool m_stop{false};
+};
+
+/// The number of threads of io_pool. The work blocks in the kernel, so
+/// the pool is sized for I/O rather than CPUs.
+static constexpr size_t IoThreads = 16;
+
+/// The pool shared by blocking file system work, such as probing paths
+/// and walking directories, started on first use.
+ThreadPool& io_pool();
+
+class AsyncCalls;
+
+/// Runs the tasks posted to it one at a time and in order on an Executor.
+class Strand
+{
+public:
+    Strand(AsyncCalls& calls)
+	: m_calls(calls)
+    { }
+    
+    void post(std::function<void()> task);
+
+private:
+    void drain();
+    
+    AsyncCalls& m_calls;
+    std::mutex m_mutex;
+    std::deque<std::function<void()>> m_tasks;
+    bool m_active{false};
+};
+
+/// The option functors running on an Executor, with one Strand per option.
+class AsyncCalls
+{
+public:
+    AsyncCalls(Executor executor, size_t noptions);
+
+    Strand& strand(size_t idx)
+    { return m_strands[idx]; }
+
+    /// Wait until every posted task has finished, then rethrow the first
+    /// exception thrown by a task, if any.
+    void wait();
+
+private:
+    friend class Strand;
+    
+    void started();
+    void finished(std::exception_ptr error);
+    
+    Executor m_executor;
+    std::deque<Strand> m_strands;
+    std::mutex m_mutex;
+    std::condition_variable m_idle;
+    size_t m_outstanding{0};
+    std::exception_ptr m_error;
+};
+
+}; // core::argp
@@ -0,0 +1,129 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace core::argp
+{
+
+template<size_t I, class T>
+struct TupleLeaf
+{
+    T value;
+};
+
+template<class Seq, class... Ts>
+struct FlatTupleBase;
+
+template<size_t... Is, class... Ts>
+struct FlatTupleBase<std::index_sequence<Is...>, Ts...> : TupleLeaf<Is, Ts>...
+{
+    constexpr FlatTupleBase(Ts&&... args)
+	: TupleLeaf<Is, Ts>{std::forward<Ts>(args)}...
+    { }
+
+    template<class F>
+    constexpr decltype(auto) apply(F&& func)
+    { return func(static_cast<TupleLeaf<Is, Ts>&>(*this).value...); }
+
+    template<class F>
+    constexpr decltype(auto) apply(F&& func) const
+    { return func(static_cast<const TupleLeaf<Is, Ts>&>(*this).value...); }
+
+    /// Call `func` with each element in order.
+    template<class F>
+    constexpr void for_each(F&& func)
+    {
+	[[maybe_unused]] int expand[] = { 0, (func(static_cast<TupleLeaf<Is, Ts>&>(*this).value), 0)... };
+    }
+
+    template<class F>
+    constexpr void for_each(F&& func) const
+    {
+	[[maybe_unused]] int expand[] = { 0, (func(static_cast<const TupleLeaf<Is, Ts>&>(*this).value), 0)... };
+    }
+};
+
+/// A tuple whose elements are direct bases of one class.
+///
+/// std::tuple is built by recursive inheritance and its constructors and
+/// std::tuple_cat recurse once per element, which exceeds the template
+/// depth limit for parsers with several hundred options. Here elements are
+/// found by overload resolution on their leaf base and iteration expands
+/// into an array initializer, so no operation recurses over the elements.
+///
+/// \tparam Ts The element types.
+template<class... Ts>
+struct FlatTuple : FlatTupleBase<std::index_sequence_for<Ts...>, Ts...>
+{
+    using Base = FlatTupleBase<std::index_sequence_for<Ts...>, Ts...>;
+    static constexpr size_t Size = sizeof...(Ts);
+
+    using Base::Base;
+
+    template<size_t I>
+    constexpr auto& get()
+    { return leaf<I>(*this).value; }
+
+    template<size_t I>
+    constexpr const auto& get() const
+    { return leaf<I>(*this).value; }
+
+private:
+    template<size_t I, class T>
+    static constexpr TupleLeaf<I, T>& leaf(TupleLeaf<I, T>& l)
+    { return l; }
+
+    template<size_t I, class T>
+    static constexpr const TupleLeaf<I, T>& leaf(const TupleLeaf<I, T>& l)
+    { return l; }
+};
+
+template<class Seq, class... Ts>
+struct TypeIndex;
+
+template<size_t... Is, class... Ts>
+struct TypeIndex<std::index_sequence<Is...>, Ts...> : TupleLeaf<Is, std::type_identity<Ts>>...
+{ };
+
+template<size_t I, class T>
+T type_at_leaf(const TupleLeaf<I, T>&);
+
+/// The `I`th type of `Ts`, found without recursion.
+template<size_t I, class... Ts>
+using type_at_t = typename decltype(
+    type_at_leaf<I>(std::declval<TypeIndex<std::index_sequence_for<Ts...>, Ts...>>()))::type;
+
+/// Select the types of `Ts` at `Positions` into `Out`.
+template<template<class...> class Out, auto Positions, class Seq, class... Ts>
+struct select_types;
+
+template<template<class...> class Out, auto Positions, size_t... Is, class... Ts>
+struct select_types<Out, Positions, std::index_sequence<Is...>, Ts...>
+{
+    using type = Out<type_at_t<Positions[Is], Ts...>...>;
+};
+
+/// The positions of the elements of `Mask` that are set.
+template<size_t N, std::array<bool, N> Mask>
+constexpr auto mask_positions()
+{
+    constexpr size_t Count = [] {
+	size_t count{0};
+	for (auto bit : Mask)
+	    count += bit;
+	return count;
+    }();
+    
+    std::array<size_t, Count> positions{};
+    for (size_t i = 0, j = 0; i < N; ++i)
+	if (Mask[i])
+	    positions[j++] = i;
+    return positions;
+}
+
+}; // core::argp
@@ -0,0 +1,62 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include "context.h"
+
+namespace core::argp
+{
+
+/// Options for the glob expansion enabled by ArgValues::with_glob.
+struct Glob
+{
+    /// Deliver the matches in lexicographic order instead of as the
+    /// walkers find them, so the values do not depend on scheduling.
+    bool sorted{false};
+
+    /// Take a pattern that matches nothing as no values instead of
+    /// raising glob_error.
+    bool allow_empty{false};
+
+    /// The number of walkers, or 0 for all of the threads of io_pool.
+    /// Patterns that only match within one directory are walked on the
+    /// calling thread.
+    size_t threads{0};
+};
+
+/// Receives the paths matched by a pattern, a batch at a time.
+using GlobSink = std::function<void(std::span<const std::string>)>;
+
+/// Return true if `token` has an unescaped `*`, `?` or `[`.
+bool is_glob_pattern(std::string_view token);
+
+/// `token` with its backslash escapes removed, as a value that is not a
+/// pattern is taken by a globbing option.
+std::string unescape_glob(std::string_view token);
+
+/// Expand the glob `pattern` given for option `name`, passing the
+/// matching paths to `sink` on the calling thread.
+///
+/// Each component of the pattern is matched with fnmatch, and `**`
+/// matches any number of directories without following symbolic links.
+/// As in the shell, wildcards do not match a leading period and a
+/// trailing `**` matches every file below it. The directories are read
+/// with getdents64 by walkers on io_pool that each descend depth first
+/// and steal the shallowest pending directory of another walker when
+/// they run out, so one large subtree is shared.
+///
+/// The walk stops as soon as more than `limit` paths match, so neither
+/// the time nor, when sorting, the memory grows past the limit.
+///
+/// \returns False if the walk stopped because more than `limit` paths
+/// matched, in which case the sorted matches are not delivered.
+/// \throws glob_error If nothing matches and `options.allow_empty` is false.
+/// \throws deadline_error If the deadline of the Limits of `ctx` passes.
+bool expand_glob(std::string_view name, std::string_view pattern, const Glob& options,
+		 const Context& ctx, size_t limit, const GlobSink& sink);
+
+}; // core::argp
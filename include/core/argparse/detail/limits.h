@@ -0,0 +1,40 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <optional>
+
+namespace core::argp
+{
+
+/// Bounds on the work done parsing a command line from an untrusted source.
+///
+/// Every limit defaults to unlimited and each one raises its own
+/// limit_error. The token and byte limits are checked before any token
+/// is examined, and the deadline is checked every few tokens, so the
+/// cost of a parse stays linear in the bounded input.
+struct Limits
+{
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t Unlimited = std::numeric_limits<size_t>::max();
+
+    /// The maximum number of tokens, excluding the program name.
+    size_t max_tokens{Unlimited};
+
+    /// The maximum total size of the tokens in bytes, excluding the program name.
+    size_t max_bytes{Unlimited};
+
+    /// The maximum length of an option group such as `-xvz`, excluding the dash.
+    size_t max_group{Unlimited};
+
+    /// The maximum number of values held by any option that takes several.
+    size_t max_values{Unlimited};
+
+    /// The time by which parsing must finish.
+    std::optional<Clock::time_point> deadline{};
+};
+
+}; // core::argp
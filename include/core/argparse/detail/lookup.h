@@ -0,0 +1,159 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <utility>
+#include "core/lexical_cast/builtin.h"
+#include "core/mp/type_name.h"
+
+namespace core::argp
+{
+
+/// An open-addressing hash index from the long names of `N` options to
+/// their indices.
+///
+/// The index is sized when the option types are known and filled when
+/// the names are, so a lookup hashes the name once and usually compares
+/// a single candidate. The first of several options with the same name
+/// wins, as in a linear scan.
+///
+/// \tparam N The number of options.
+template<size_t N>
+class NameIndex
+{
+public:
+    static constexpr size_t Slots = std::bit_ceil(2 * N + 1);
+
+    constexpr NameIndex(const std::array<std::string_view, N>& names)
+    {
+	m_slots.fill(-1);
+	for (size_t idx = 0; idx < N; ++idx)
+	    if (find(names[idx], names) < 0)
+	    {
+		auto slot = hash(names[idx]) & (Slots - 1);
+		while (m_slots[slot] >= 0)
+		    slot = (slot + 1) & (Slots - 1);
+		m_slots[slot] = idx;
+	    }
+    }
+
+    /// The index of the option named `name` in `names`, or -1 if there is none.
+    constexpr int find(std::string_view name, const std::array<std::string_view, N>& names) const
+    {
+	for (auto slot = hash(name) & (Slots - 1); m_slots[slot] >= 0; slot = (slot + 1) & (Slots - 1))
+	    if (names[m_slots[slot]] == name)
+		return m_slots[slot];
+	return -1;
+    }
+
+private:
+    // FNV-1a
+    static constexpr size_t hash(std::string_view name)
+    {
+	uint64_t h = 0xcbf29ce484222325;
+	for (auto c : name)
+	    h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+	return h;
+    }
+
+    std::array<int, Slots> m_slots{};
+};
+
+/// The text form of an option value.
+///
+/// Values with a lexical_cast use its to_string, containers join their
+/// elements with spaces as they are given on the command line and map
+/// entries are written as `key=value`.
+template<class T>
+std::string value_to_string(const T& value)
+{
+    if constexpr (std::is_convertible_v<const T&, std::string_view>)
+	return std::string(std::string_view(value));
+    else if constexpr (requires { core::lexical_cast_detail::lexical_cast_impl<T>{}.to_string(value); })
+	return core::lexical_to_string(value);
+    else if constexpr (requires { value.first; value.second; })
+	return value_to_string(value.first) + "=" + value_to_string(value.second);
+    else if constexpr (requires { value.begin(); value.end(); })
+    {
+	std::string r;
+	for (const auto& elem : value)
+	    (r += r.empty() ? "" : " ") += value_to_string(elem);
+	return r;
+    }
+    else
+	return "<" + std::string(core::mp::type_name<T>()) + ">";
+}
+
+/// A type-erased view of the value of one option, as returned by ArgParse::find.
+///
+/// The view refers to the value held by the parser, so it is only valid
+/// while the parser is and it sees the value change if the parser parses
+/// again.
+class OptionView
+{
+public:
+    OptionView() = default;
+
+    template<class T>
+    OptionView(std::string_view long_name, char flag, size_t count, const T& value)
+	: m_long_name(long_name)
+	, m_flag(flag)
+	, m_count(count)
+	, m_value(&value)
+	, m_type(&typeid(T))
+	, m_to_string([](const void *ptr) { return value_to_string(*static_cast<const T*>(ptr)); })
+    { }
+
+    std::string_view long_name() const
+    { return m_long_name; }
+
+    char flag() const
+    { return m_flag; }
+
+    /// The number of times the option occurred.
+    size_t count() const
+    { return m_count; }
+
+    /// The type of the value, which is the tag checked by as.
+    const std::type_info& type() const
+    { return *m_type; }
+
+    template<class T>
+    bool is() const
+    { return *m_type == typeid(T); }
+
+    /// The value, which must have type `T` exactly.
+    ///
+    /// \throws std::bad_cast If the value has another type.
+    template<class T>
+    const T& as() const
+    {
+	if (not is<T>())
+	    throw std::bad_cast();
+	return *static_cast<const T*>(m_value);
+    }
+
+    /// A pointer to the value if it has type `T`, otherwise nullptr.
+    template<class T>
+    const T *get_if() const
+    { return is<T>() ? static_cast<const T*>(m_value) : nullptr; }
+
+    std::string to_string() const
+    { return m_to_string(m_value); }
+
+private:
+    std::string_view m_long_name;
+    char m_flag{'\0'};
+    size_t m_count{0};
+    const void *m_value{nullptr};
+    const std::type_info *m_type{&typeid(void)};
+    std::string (*m_to_string)(const void*){nullptr};
+};
+
+}; // core::argp
@@ -6,11 +6,25 @@
 namespace core::argp {
 
 static constexpr auto unknown_option_msg = "unknown option '{}'.";
+static constexpr auto suggestion_msg = " Did you mean {}?";
 static constexpr auto missing_value_msg = "no value supplied for option '{}', expecting type '{}'";
+static constexpr auto unexpected_value_msg = "option '{}' does not take a value, but was given '{}'";
 static constexpr auto bad_value_msg = "cannot parse user input '{}' as type '{}' for option '{}'";
 static constexpr auto too_few_values_msg =
     "needed at least {} value(s) of type '{}' for option '{}', but found {}";
 static constexpr auto too_many_values_msg =
     "needed at most {} value(s) of type '{}' for option '{}', but found {}";
+static constexpr auto token_limit_msg = "found {} tokens, exceeding the limit of {}";
+static constexpr auto byte_limit_msg = "found at least {} bytes of tokens, exceeding the limit of {}";
+static constexpr auto group_limit_msg = "option group '{}' has {} characters, exceeding the limit of {}";
+static constexpr auto value_limit_msg = "found {} values for option '{}', exceeding the limit of {}";
+static constexpr auto deadline_msg = "parsing did not finish by its deadline";
+static constexpr auto no_match_msg = "pattern '{}' for option '{}' matched no files";
+static constexpr auto glob_depth_msg = "pattern '{}' for option '{}' has more than {} components";
+static constexpr auto unbound_msg =
+    "an option is stored in a member of '{}', but ArgParse::bind was not called with one";
+static constexpr auto requires_msg = "option '{}' requires option '{}'";
+static constexpr auto conflicts_msg = "option '{}' conflicts with option '{}'";
+static constexpr auto one_of_msg = "exactly one of the options {} is required, but found {}";
 
 }; // core::argp
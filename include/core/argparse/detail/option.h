@@ -2,10 +2,16 @@
 //
 
 #pragma once
+#include <algorithm>
+#include <concepts>
+#include <optional>
 #include <set>
 #include "base.h"
+#include "container.h"
 #include "context.h"
 #include "error.h"
+#include "executor.h"
+#include "glob.h"
 #include "core/lexical_cast/builtin.h"
 #include "core/lexical_cast/string.h"
 #include "core/lexical_cast/optional.h"
@@ -21,60 +27,164 @@ struct noop
     constexpr void operator()(Ts&...) const noexcept { }
 };
 
+/// Storage for an option value that is owned by the option.
+///
+/// \tparam T The value type.
+template<class T>
+struct OwnedValue
+{
+    constexpr OwnedValue(T default_value = T{})
+	: value(std::move(default_value))
+    { }
+
+    T& ref() { return value; }
+    const T& ref() const { return value; }
+
+    template<class S>
+    void bind(S&) { }
+
+    T value;
+};
+
+/// Storage for an option value that lives in a member of a caller-owned struct.
+///
+/// \note The struct must be bound with ArgParse::bind before the value
+/// is parsed or read, otherwise unbound_error is thrown.
+/// \tparam S The struct type.
+/// \tparam T The member type.
+template<class S, class T>
+struct BoundValue
+{
+    constexpr BoundValue(T S::*arg_member)
+	: member(arg_member)
+    { }
+
+    T& ref()
+    {
+	if (target == nullptr) [[unlikely]]
+	    throw_unbound(typeid(S));
+	return target->*member;
+    }
+
+    const T& ref() const
+    {
+	if (target == nullptr) [[unlikely]]
+	    throw_unbound(typeid(S));
+	return target->*member;
+    }
+
+    template<class U>
+    void bind(U& object)
+    {
+	if constexpr (std::is_same_v<U, S>)
+	    target = &object;
+    }
+
+    T S::*member;
+    S *target{nullptr};
+};
+
+/// Common description of all arguments.
+///
+/// \note Parse results such as the occurrence count are kept by ArgParse.
+/// \note The names and description are referenced, not copied, so they must
+/// outlive the argument (string literals always do). Construction performs
+/// no allocation, so argument tables can be declared constinit.
 template<char C>
 struct ArgBase
 {
     static constexpr char FlagCharacter = C;
+    static constexpr char ShortName[] = { OptionSymbol, C, '\0' };
 
-    ArgBase(std::string_view arg_long_name, std::string_view arg_description)
+    constexpr ArgBase(std::string_view arg_long_name, std::string_view arg_description)
 	: long_name(arg_long_name)
 	, description(arg_description)
     { }
 
-    bool matches(std::string_view token) const
+    /// The parameter name shown in the help message, which is the
+    /// `spec_name()` of types that name their own choices.
+    template<class T>
+    std::string spec_name() const
     {
-	if (token.size() == 2 and token[0] == OptionSymbol)
-	    return token[1] == FlagCharacter;
-	if (token.size() == long_name.size() + 2
-	    and token[0] == OptionSymbol
-	    and token[1] == OptionSymbol)
-	    return token.substr(2) == long_name;
-	return false;
+	if constexpr (requires { { T::spec_name() } -> std::convertible_to<std::string>; })
+	    return T::spec_name();
+	else if constexpr (FlagCharacter == '*') return std::string(long_name);
+	else return std::string(core::mp::type_name<T>());
     }
 
-    std::string long_name;
-    std::string description;
-    std::string value_spec;
-    size_t count{0};
+    /// Call `func` with `args`, or with copies of them on this argument's
+    /// strand when ArgParse has an executor. A functor running on a strand
+    /// therefore cannot change the value that is stored.
+    template<class F, class... Args>
+    void invoke(F& func, Args&... args) const
+    {
+	if constexpr (std::is_same_v<F, noop>)
+	    return;
+	else if (strand)
+	    strand->post([&func, ...values = owned(args)]() mutable { func(values...); });
+	else
+	    func(args...);
+    }
+
+    // A copy of `value` that outlives the tokens it may refer to.
+    template<class T>
+    static auto owned(const T& value)
+    {
+	if constexpr (std::is_same_v<T, std::string_view>) return std::string(value);
+	else return value;
+    }
+
+    std::string_view long_name;
+    std::string_view description;
+    Strand *strand{nullptr};
 };
 
 /// Describes an argument with no parameters.
 ///
 /// \tparam C The single character version of the argument name.
 /// \tparam F The optional functor.
+/// \tparam V The value storage.
 /// 
-template<char C, class F>
+template<char C, class F, class V = OwnedValue<bool>>
 struct ArgFlag : ArgBase<C>
 {
+    static constexpr bool TakesValue = false;
+
     /// Construct an ArgFlag
     ///
     /// \note Use the free function argFlag to construct an ArgFlag.
     /// \param long_name The long version of the argument name.
     /// \param description A description of the argument.
     /// \param func Functor applied when argument is recognized during parsing.
-    ArgFlag(std::string_view long_name, std::string_view description, F&& func)
+    /// \param arg_storage The value storage.
+    constexpr ArgFlag(std::string_view long_name, std::string_view description, F&& func,
+		      V arg_storage = V{})
 	: ArgBase<C>(long_name, description)
+	, storage(std::move(arg_storage))
 	, function(std::move(func))
     { }
 
-    void match(std::string_view token, Context& ctx)
+    /// The parameter specification shown in the help message.
+    std::string value_spec() const
+    { return std::string(); }
+
+    void match(std::string_view token, std::optional<std::string_view> attached, Context& ctx)
+    {
+	if (attached)
+	    throw_unexpected_value(token, *attached, ctx);
+
+	storage.ref() = true;
+	this->invoke(function);
+    }
+
+    /// Call the functor as parsing would have for `count` occurrences.
+    void replay(size_t count)
     {
-	++this->count;
-	value = true;
-	function();
+	for (size_t i = 0; i < count; ++i)
+	    function();
     }
     
-    bool value{false};
+    V storage;
     F function;
 };
 
@@ -84,7 +194,7 @@ struct ArgFlag : ArgBase<C>
 /// \param long_name The long version of the argument name.
 /// \param description A description of the argument.
 template<char C>
-auto argFlag(std::string_view long_name, std::string_view description)
+constexpr auto argFlag(std::string_view long_name, std::string_view description)
 { return ArgFlag<C,noop>(long_name, description, std::move(noop{})); }
 
 /// Construct an ArgFlag describing an argument with no parameters.
@@ -95,50 +205,83 @@ auto argFlag(std::string_view long_name, std::string_view description)
 /// \param description A description of the argument.
 /// \param func Functor applied when argument is recognized during parsing.
 template<char C, class F>
-auto argFlag(std::string_view long_name, std::string_view description, F&& func = noop{})
+constexpr auto argFlag(std::string_view long_name, std::string_view description, F&& func = noop{})
 { return ArgFlag<C,F>(long_name, description, std::move(func)); }
 
+/// Construct an ArgFlag that stores its state in a member of a caller-owned struct.
+///
+/// \tparam C The single character version of the argument name.
+/// \param member Pointer to the bool member that receives the flag state.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+template<char C, class S>
+constexpr auto argFlag(bool S::*member, std::string_view long_name, std::string_view description)
+{ return ArgFlag<C,noop,BoundValue<S,bool>>(long_name, description, noop{}, member); }
+
+/// Construct an ArgFlag that stores its state in a member of a caller-owned struct.
+///
+/// \tparam C The single character version of the argument name.
+/// \param member Pointer to the bool member that receives the flag state.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param func Functor applied when argument is recognized during parsing.
+template<char C, class S, class F>
+constexpr auto argFlag(bool S::*member, std::string_view long_name, std::string_view description, F&& func)
+{ return ArgFlag<C,F,BoundValue<S,bool>>(long_name, description, std::move(func), member); }
+
 /// Describes an argument that takes exactly one parameter.
 ///
 /// \tparam C The single character version of the argument name.
 /// \tparam T The parameter type.
 /// \tparam F The functor type.
-template<char C, class T, class F>
+/// \tparam V The value storage.
+template<char C, class T, class F, class V = OwnedValue<T>>
 struct ArgValue : ArgBase<C>
 {
     using Base = ArgBase<C>;
+    static constexpr bool TakesValue = true;
 
     /// Construct an ArgValue
     ///
     /// \note Use the free functions argValue to construct an ArgValue.
     /// \param long_name The long version of the argument name.
-    /// \param default_value The default value of the parameter.
+    /// \param default_value The default value of the parameter (or its storage).
     /// \param description A description of the argument.
     /// \param func Functor applied when argument is recognized during parsing.
-    ArgValue(std::string_view long_name, T default_value, std::string_view description, F&& func)
+    constexpr ArgValue(std::string_view long_name, V default_value, std::string_view description, F&& func)
 	: Base(long_name, description)
-	, value(default_value)
+	, storage(std::move(default_value))
 	, function(std::move(func))
-    {
-	if (Base::FlagCharacter == '*') Base::value_spec = make_spec(long_name, 1, 1);
-	else Base::value_spec = make_spec(core::mp::type_name<T>(), 1, 1);
-    }
+    { }
+
+    /// The parameter specification shown in the help message.
+    std::string value_spec() const
+    { return make_spec(Base::template spec_name<T>(), 1, 1); }
     
-    void match(std::string_view token, Context& ctx)
+    void match(std::string_view token, std::optional<std::string_view> attached, Context& ctx)
     {
-	if (ctx.end() or is_option(ctx.front()))
-	    throw missing_value_error(token, ctx, typeid(T));
-	
-	try { value = core::lexical_cast<T>(ctx.front()); }
+	if (not attached and (ctx.end() or is_option(ctx.front())))
+	    throw_missing_value(token, ctx, typeid(T));
+
+	auto input = attached ? *attached : ctx.front();
+	auto& value = storage.ref();
+	try { value = core::lexical_cast<T>(input); }
 	catch (const core::lexical_cast_error& error)
-	{ throw bad_value_error(token, ctx, typeid(T)); }
+	{ throw_bad_value(token, input, ctx, typeid(T)); }
 
-	ctx.pop();
-	function(value);
-	++Base::count;
+	if (not attached)
+	    ctx.pop();
+	this->invoke(function, value);
     }
 
-    T value;
+    /// Call the functor with the final value when the argument occurred.
+    void replay(size_t count)
+    {
+	if (count > 0)
+	    function(storage.ref());
+    }
+
+    V storage;
     F function;
 };
 
@@ -149,7 +292,7 @@ struct ArgValue : ArgBase<C>
 /// \param long_name The long version of the argument name.
 /// \param description A description of the argument.
 template<char C, class T>
-auto argValue(std::string_view long_name, std::string_view description)
+constexpr auto argValue(std::string_view long_name, std::string_view description)
 { return ArgValue<C,T,noop>(long_name, T{}, description, std::move(noop{})); }
 
 /// Construct an ArgValue descibing an argument that takes exactly one paramter.
@@ -160,7 +303,7 @@ auto argValue(std::string_view long_name, std::string_view description)
 /// \param default_value The default value of the parameter.
 /// \param description A description of the argument.
 template<char C, class T>
-auto argValue(std::string_view long_name, T default_value, std::string_view description)
+constexpr auto argValue(std::string_view long_name, T default_value, std::string_view description)
 { return ArgValue<C,T,noop>(long_name, default_value, description, std::move(noop{})); }
 
 /// Construct an ArgValue descibing an argument that takes exactly one paramter.
@@ -171,7 +314,7 @@ auto argValue(std::string_view long_name, T default_value, std::string_view desc
 /// \param description A description of the argument.
 /// \param func The functor to apply when the argument is recognized during parsing.
 template<char C, class T, class F>
-auto argValue(std::string_view long_name, std::string_view description, F&& func)
+constexpr auto argValue(std::string_view long_name, std::string_view description, F&& func)
 { return ArgValue<C,T,F>(long_name, T{}, description, std::move(func)); }
 
 /// Construct an ArgValue descibing an argument that takes exactly one paramter.
@@ -183,70 +326,316 @@ auto argValue(std::string_view long_name, std::string_view description, F&& func
 /// \param description A description of the argument.
 /// \param func The functor to apply when the argument is recognized during parsing.
 template<char C, class T, class F>
-auto argValue(std::string_view long_name, T default_value, std::string_view description, F&& func)
+constexpr auto argValue(std::string_view long_name, T default_value, std::string_view description, F&& func)
 { return ArgValue<C,T,F>(long_name, default_value, description, std::move(func)); }
 
-template<class Container, class T>
-void emplace(Container& container, T&& value)
-{
-    if constexpr (std::is_same_v<Container, std::set<T>>)
-		     container.emplace(std::forward<T>(value));
-    else
-	container.emplace_back(std::forward<T>(value));
-}
+/// Construct an ArgValue that stores its parameter in a member of a caller-owned struct.
+///
+/// \note The current value of the member serves as the default value.
+/// \tparam C The single character version of the argument name.
+/// \param member Pointer to the member that receives the parameter.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+template<char C, class S, class T>
+constexpr auto argValue(T S::*member, std::string_view long_name, std::string_view description)
+{ return ArgValue<C,T,noop,BoundValue<S,T>>(long_name, member, description, noop{}); }
 
-template<char C, template<class...> class Container, class T, class F>
+/// Construct an ArgValue that stores its parameter in a member of a caller-owned struct.
+///
+/// \note The current value of the member serves as the default value.
+/// \tparam C The single character version of the argument name.
+/// \param member Pointer to the member that receives the parameter.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param func The functor to apply when the argument is recognized during parsing.
+template<char C, class S, class T, class F>
+constexpr auto argValue(T S::*member, std::string_view long_name, std::string_view description, F&& func)
+{ return ArgValue<C,T,F,BoundValue<S,T>>(long_name, member, description, std::move(func)); }
+
+/// Describes an argument that takes zero or more parameters.
+///
+/// \tparam C The single character version of the argument name.
+/// \tparam Coll The container type holding the parameters.
+/// \tparam F The functor type.
+/// \tparam V The value storage.
+template<char C, class Coll, class F, class V = OwnedValue<Coll>>
 struct ArgValues : ArgBase<C>
 {
     using Base = ArgBase<C>;
-    ArgValues(std::string_view long_name, std::string_view description, size_t amin, size_t amax, F&& func)
+    using Traits = container_traits<Coll>;
+    using T = container_element_t<Coll>;
+    static constexpr bool TakesValue = true;
+    static constexpr bool Prefetched = prefetch_traits<T>::Enabled and not map_container<Coll>;
+
+    constexpr ArgValues(std::string_view long_name, std::string_view description,
+			size_t amin, size_t amax, F&& func, V arg_storage = V{})
 	: Base(long_name, description)
 	, min(amin)
 	, max(amax)
+	, storage(std::move(arg_storage))
 	, function(std::move(func))
+    { }
+
+    /// The parameter specification shown in the help message.
+    std::string value_spec() const
+    { return make_spec(Base::template spec_name<T>(), min, max); }
+
+    /// Expand the values that are glob patterns into the paths they match.
+    ///
+    /// A pattern such as `'data/**/*.parquet'` is quoted so the shell
+    /// passes it through, then expanded by expand_glob with the matches
+    /// going straight to the functor and container. This avoids the
+    /// ARG_MAX limit and the cost of the shell expanding many paths. The
+    /// paths count toward min, max and Limits::max_values. Values without
+    /// an unescaped `*`, `?` or `[` are taken with their escapes removed,
+    /// so `star\*` names the file `star*`. parse_cached only sees the
+    /// patterns, so pass the directories walked as dependencies.
+    ///
+    /// \param options How the patterns are expanded.
+    constexpr ArgValues with_glob(Glob options = {}) &&
     {
-	if (Base::FlagCharacter == '*') Base::value_spec = make_spec(long_name, min, max);
-	else Base::value_spec = make_spec(core::mp::type_name<T>(), min, max);
+	static_assert(not std::is_same_v<T, std::string_view>,
+		      "The paths matched by a glob do not outlive the expansion.");
+	glob = options;
+	return std::move(*this);
     }
-    
-    void match(std::string_view token, Context& ctx)
+
+    void match(std::string_view token, std::optional<std::string_view> attached, Context& ctx)
     {
-	while (not ctx.end() and
-	       not is_option(ctx.front()) and
-	       not is_option_separator(ctx.front()))
+	auto count = ctx.count_values();
+	auto limit = bound(ctx);
+	Inserter<Coll> inserter(storage.ref(), std::min(count + (attached ? 1 : 0), limit));
+	if (attached)
+	    accept(inserter, token, *attached, ctx);
+
+	// A pattern is not a path, so the tokens of a globbing option are
+	// not prefetched. The paths they match are, by accept_glob.
+	bool prefetch = Prefetched and not glob;
+	if constexpr (Prefetched)
+	    if (prefetch)
+	    {
+		auto ahead = std::min(count, limit);
+		auto batch = prefetch_traits<T>::start(ctx.peek(ahead));
+		for (size_t i = 0; i < count; ++i, ctx.pop())
+		    accept(inserter, token, ctx.front(), ctx, [&](std::string_view input) {
+			if (i < ahead) return prefetch_traits<T>::convert(batch, i, input);
+			return Traits::convert(input);
+		    });
+	    }
+
+	if (not prefetch)
 	{
-	    try
+	    while (not ctx.end() and not ctx.ends_values(ctx.front()))
 	    {
-		auto&& v = core::lexical_cast<T>(ctx.front());
-		function(v);
-		emplace(value, std::forward<T>(v));
+		accept(inserter, token, ctx.front(), ctx);
+		ctx.pop();
 	    }
-	    catch (const core::lexical_cast_error& error)
-	    { throw bad_value_error(token, ctx, typeid(T)); }
+	}
+	inserter.finish();
+	check_count(inserter.count(), ctx);
+    }
 
-	    ctx.pop();
+    /// Begin an occurrence whose values are pushed one at a time.
+    void open()
+    { pending.emplace(storage.ref(), 0); }
+
+    /// Add the next value of the occurrence begun by open.
+    void push(std::string_view token, std::string_view input, Context& ctx)
+    { accept(*pending, token, input, ctx); }
+
+    /// End the occurrence begun by open.
+    void close(const Context& ctx)
+    {
+	pending->finish();
+	auto count = pending->count();
+	pending.reset();
+	check_count(count, ctx);
+    }
+
+    void check_count(size_t count, const Context& ctx) const
+    {
+	if (count < min or count > max)
+	    throw_value_count(Base::long_name, ctx, typeid(T), count, min, max, max);
+    }
+
+    /// The number of values beyond which accepting stops.
+    size_t bound(const Context& ctx) const
+    { return std::min(max, ctx.limits().max_values); }
+
+    void accept(Inserter<Coll>& inserter, std::string_view token, std::string_view input, Context& ctx)
+    {
+	if (glob and is_glob_pattern(input))
+	    accept_glob(inserter, token, input, ctx);
+	else if (glob and input.find('\\') != std::string_view::npos)
+	    accept(inserter, token, unescape_glob(input), ctx, Traits::convert);
+	else
+	    accept(inserter, token, input, ctx, Traits::convert);
+    }
+
+    /// Accept each path matched by `pattern`, prefetching them in batches
+    /// when the value type supports it. The walk stops once more paths
+    /// match than bound allows, which is then a value count error.
+    void accept_glob(Inserter<Coll>& inserter, std::string_view token, std::string_view pattern, Context& ctx)
+    {
+	auto limit = bound(ctx);
+	auto complete = expand_glob(Base::long_name, pattern, *glob, ctx, limit, [&](std::span<const std::string> paths) {
+	    if constexpr (Prefetched)
+	    {
+		auto batch = prefetch_traits<T>::start(paths);
+		for (size_t i = 0; i < paths.size(); ++i)
+		    accept(inserter, token, paths[i], ctx, [&](std::string_view input) {
+			return prefetch_traits<T>::convert(batch, i, input);
+		    });
+	    }
+	    else
+		for (const auto& path : paths)
+		    accept(inserter, token, path, ctx, Traits::convert);
+	});
+	if (not complete)
+	    throw_value_count(Base::long_name, ctx, typeid(T), limit + 1, 0, max, limit);
+    }
+
+    template<class Convert>
+    void accept(Inserter<Coll>& inserter, std::string_view token, std::string_view input, Context& ctx,
+		Convert&& convert)
+    {
+	try
+	{
+	    auto v = convert(input);
+	    check_bound(inserter, v, ctx);
+	    this->invoke(function, v);
+	    inserter.add(std::move(v));
 	}
+	catch (const core::lexical_cast_error& error)
+	{ throw_bad_value(token, input, ctx, typeid(T)); }
+    }
 
-	auto count = value.size();
-	if (count < min)
-	    throw too_few_values_error(Base::long_name, ctx, typeid(T), count, min);
-	else if (count > max)
-	    throw too_many_values_error(Base::long_name, ctx, typeid(T), count, max);
+    /// Stop at the first value past the bound, before the functor sees it
+    /// and without converting the rest. Set and map inserters only count
+    /// a value that they do not already hold.
+    template<class U>
+    void check_bound(Inserter<Coll>& inserter, const U& value, const Context& ctx)
+    {
+	if (auto limit = bound(ctx); inserter.count() >= limit)
+	    if (auto count = inserter.count_with(value); count > limit)
+		throw_value_count(Base::long_name, ctx, typeid(T), count, 0, max, limit);
+    }
+
+    /// Call the functor with each collected value when the argument occurred.
+    ///
+    /// \note The values are those stored, so duplicates dropped by a set or
+    /// map container are not replayed.
+    void replay(size_t count)
+    {
+	if (count == 0)
+	    return;
+	for (const auto& elem : storage.ref())
+	{
+	    T v(elem);
+	    function(v);
+	}
     }
 
     size_t min, max;
-    Container<T> value;
+    V storage;
     F function;
+    std::optional<Glob> glob;
+    std::optional<Inserter<Coll>> pending;
 };
 
+/// Construct an ArgValues describing an argument that takes zero or more parameters.
+///
+/// \tparam C The single character version of the argument name.
+/// \tparam Container The container template, such as std::vector or std::set.
+/// \tparam T The type of the parameters.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param min The minimum number of parameters.
+/// \param max The maximum number of parameters.
 template<char C, template<class...> class Container, class T>
-auto argValues(std::string_view long_name, std::string_view description,
+constexpr auto argValues(std::string_view long_name, std::string_view description,
 	       size_t min = 1, size_t max = std::numeric_limits<size_t>::max())
-{ return ArgValues<C,Container,T,noop>(long_name, description, min, max, std::move(noop{})); }
+{ return ArgValues<C,Container<T>,noop>(long_name, description, min, max, std::move(noop{})); }
 
+/// Construct an ArgValues describing an argument that takes zero or more parameters.
+///
+/// \note A std::array defaults to exactly as many parameters as it holds and a
+/// map container takes `key=value` parameters.
+/// \tparam C The single character version of the argument name.
+/// \tparam Coll The container type, such as std::array<int,3> or std::map<std::string,int>.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param min The minimum number of parameters.
+/// \param max The maximum number of parameters.
+template<char C, class Coll>
+constexpr auto argValues(std::string_view long_name, std::string_view description,
+			 size_t min = container_traits<Coll>::Min,
+			 size_t max = container_traits<Coll>::Max)
+{ return ArgValues<C,Coll,noop>(long_name, description, min, max, std::move(noop{})); }
+
+/// Construct an ArgValues describing an argument that takes zero or more parameters.
+///
+/// \tparam C The single character version of the argument name.
+/// \tparam Container The container template, such as std::vector or std::set.
+/// \tparam T The type of the parameters.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param func The functor to apply to each parameter during parsing.
+/// \param min The minimum number of parameters.
+/// \param max The maximum number of parameters.
 template<char C, template<class...> class Container, class T, class F>
-auto argValuesApply(std::string_view long_name, std::string_view description, F&& func,
+constexpr auto argValuesApply(std::string_view long_name, std::string_view description, F&& func,
 		    size_t min = 1, size_t max = std::numeric_limits<size_t>::max())
-{ return ArgValues<C,Container,T,F>(long_name, description, min, max, std::move(func)); }
+{ return ArgValues<C,Container<T>,F>(long_name, description, min, max, std::move(func)); }
+
+/// Construct an ArgValues describing an argument that takes zero or more parameters.
+///
+/// \tparam C The single character version of the argument name.
+/// \tparam Coll The container type, such as std::array<int,3> or std::map<std::string,int>.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param func The functor to apply to each parameter during parsing.
+/// \param min The minimum number of parameters.
+/// \param max The maximum number of parameters.
+template<char C, class Coll, class F>
+constexpr auto argValuesApply(std::string_view long_name, std::string_view description, F&& func,
+			      size_t min = container_traits<Coll>::Min,
+			      size_t max = container_traits<Coll>::Max)
+{ return ArgValues<C,Coll,F>(long_name, description, min, max, std::move(func)); }
+
+/// Construct an ArgValues that stores its parameters in a container member of a
+/// caller-owned struct.
+///
+/// \tparam C The single character version of the argument name.
+/// \param member Pointer to the container member that receives the parameters.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param min The minimum number of parameters.
+/// \param max The maximum number of parameters.
+template<char C, class S, class Coll>
+constexpr auto argValues(Coll S::*member, std::string_view long_name, std::string_view description,
+			 size_t min = container_traits<Coll>::Min,
+			 size_t max = container_traits<Coll>::Max)
+{ return ArgValues<C,Coll,noop,BoundValue<S,Coll>>(long_name, description, min, max, noop{}, member); }
+
+/// Construct an ArgValues that stores its parameters in a container member of a
+/// caller-owned struct.
+///
+/// \tparam C The single character version of the argument name.
+/// \param member Pointer to the container member that receives the parameters.
+/// \param long_name The long version of the argument name.
+/// \param description A description of the argument.
+/// \param func The functor to apply to each parameter during parsing.
+/// \param min The minimum number of parameters.
+/// \param max The maximum number of parameters.
+template<char C, class S, class Coll, class F>
+constexpr auto argValuesApply(Coll S::*member, std::string_view long_name,
+			      std::string_view description, F&& func,
+			      size_t min = container_traits<Coll>::Min,
+			      size_t max = container_traits<Coll>::Max)
+{
+    using Storage = BoundValue<S,Coll>;
+    return ArgValues<C,Coll,F,Storage>(long_name, description, min, max, std::move(func), member);
+}
 
 }; // core::argp
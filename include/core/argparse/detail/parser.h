@@ -3,151 +3,329 @@
 
 #pragma once
 #include <any>
-#include <iostream>
+#include <array>
+#include <iosfwd>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <utility>
 #include "base.h"
+#include "cache.h"
+#include "constraint.h"
 #include "context.h"
+#include "dump.h"
 #include "error.h"
-#include "core/tuple/find.h"
-#include "core/tuple/map.h"
-#include "core/tuple/fold.h"
-#include "core/mp/constants.h"
-#include "core/mp/find_index.h"
-#include "core/mp/transform.h"
+#include "executor.h"
+#include "flat_tuple.h"
+#include "lookup.h"
+#include "report.h"
+#include "state.h"
+#include "suggest.h"
 
 namespace core::argp {
 
 template<class T>
-using flag_character = core::mp::_char<T::FlagCharacter>;
+struct option_list;
+
+template<class... Ts>
+struct option_list<FlatTuple<Ts...>>
+{
+    /// Option index for each flag character, or -1 when there is none.
+    static constexpr std::array<int, 256> FlagIndex = []() {
+	std::array<int, 256> table;
+	table.fill(-1);
+	constexpr std::array<char, sizeof...(Ts)> Characters = { Ts::FlagCharacter... };
+	for (size_t idx = Characters.size(); idx-- > 0; )
+	    table[static_cast<unsigned char>(Characters[idx])] = idx;
+	return table;
+    }();
+
+    /// Call `func` with the element of `tuple` at runtime index `idx`.
+    ///
+    /// Dispatch goes through a table of function pointers built from an
+    /// index_sequence, so it costs one instantiation per option instead of
+    /// a recursive chain.
+    template<class Tuple, class F>
+    static void dispatch(Tuple& tuple, size_t idx, F& func)
+    {
+	using Entry = void (*)(Tuple&, F&);
+	static constexpr auto Table = []<size_t... Is>(std::index_sequence<Is...>) {
+	    return std::array<Entry, sizeof...(Is)>{
+		[](Tuple& t, F& f) { f(t.template get<Is>()); }...
+	    };
+	}(std::index_sequence_for<Ts...>{});
+	Table[idx](tuple, func);
+    }
+};
 
 /// Describes a set of command line arguments.
 ///
-/// \tparam Ts ArgFlag, ArgValue or ArgValues
+/// \tparam Ts ArgFlag, ArgValue, ArgValues or constraints
 template<class... Ts>
 class ArgParse
 {
 public:
-    using Tuple = std::tuple<Ts...>;
-    using Flags = core::mp::transform_t<flag_character, core::mp::list<Ts...>>;
+    static constexpr std::array<bool, sizeof...(Ts)> ConstraintMask = { is_constraint_v<Ts>... };
+    static constexpr std::array<bool, sizeof...(Ts)> OptionMask = { not is_constraint_v<Ts>... };
+    static constexpr auto OptionPositions = mask_positions<sizeof...(Ts), OptionMask>();
+    static constexpr auto ConstraintPositions = mask_positions<sizeof...(Ts), ConstraintMask>();
+    
+    using Tuple = typename select_types<FlatTuple, OptionPositions,
+					std::make_index_sequence<OptionPositions.size()>, Ts...>::type;
+    using Constraints = typename select_types<std::tuple, ConstraintPositions,
+					      std::make_index_sequence<ConstraintPositions.size()>, Ts...>::type;
+    static constexpr size_t Size = Tuple::Size;
+    static constexpr const auto& FlagIndex = option_list<Tuple>::FlagIndex;
 
     /// Construct a description of a set of command line arguments.
     ///
-    /// \param args Descriptions of individual arguments.
-    ArgParse(Ts&&... args)
-	: m_tuple(std::make_tuple(std::move(args)...))
+    /// \param args Descriptions of individual arguments and the constraints between them.
+    constexpr ArgParse(Ts&&... args)
+	: m_tuple(make_options(FlatTuple<Ts&...>(args...), std::make_index_sequence<Size>{}))
+	, m_long_names(m_tuple.apply([](const auto&... e) {
+	    return std::array<std::string_view, Size>{ e.long_name... };
+	}))
+	, m_name_index(m_long_names)
     { }
 
     template<char C>
-    auto get()
+    auto get() const
     {
-	constexpr auto Idx = core::mp::find_index_v<Flags, core::mp::_char<C>>;
-	static_assert(Idx < std::tuple_size_v<Tuple>, "\n\n"
+	constexpr auto Idx = FlagIndex[static_cast<unsigned char>(C)];
+	static_assert(Idx >= 0, "\n\n"
 		      "static assertion: No option with the given name exists.\n"
 		      "static assertion: Ignore subsequent compiler errors for the next line.\n");
-	return std::get<Idx>(m_tuple).value;
+	return m_tuple.template get<Idx < 0 ? 0 : Idx>().storage.ref();
     }
 
     template<char C>
-    auto get_count()
+    auto get_count() const
     {
-	constexpr auto Idx = core::mp::find_index_v<Flags, core::mp::_char<C>>;
-	static_assert(Idx < std::tuple_size_v<Tuple>, "\n\n"
+	constexpr auto Idx = FlagIndex[static_cast<unsigned char>(C)];
+	static_assert(Idx >= 0, "\n\n"
 		      "static assertion: No option with the given name exists.\n"
 		      "static assertion: Ignore subsequent compiler errors for the next line.\n");
-	return std::get<Idx>(m_tuple).count;
+	return m_state.counts[Idx];
+    }
+
+    /// Find an option by a name known only at runtime.
+    ///
+    /// \param name A long name or flag character, with or without its dashes.
+    /// \returns A view of the option, or nothing if no option has the name.
+    std::optional<OptionView> find(std::string_view name) const
+    {
+	int idx{-1};
+	if (name.starts_with("--")) idx = m_name_index.find(name.substr(2), m_long_names);
+	else if (name.size() == 2 and name[0] == OptionSymbol) idx = flag_index(name[1]);
+	else if (name.size() == 1) idx = flag_index(name[0]);
+	if (idx < 0 and not name.starts_with(OptionSymbol))
+	    idx = m_name_index.find(name, m_long_names);
+	
+	if (idx < 0)
+	    return std::nullopt;
+	return view(idx);
+    }
+
+    /// The options that occurred, in declaration order.
+    class PresentOptions
+    {
+    public:
+	class iterator
+	{
+	public:
+	    using iterator_category = std::forward_iterator_tag;
+	    using value_type = OptionView;
+	    using difference_type = std::ptrdiff_t;
+	    using pointer = void;
+	    using reference = OptionView;
+
+	    iterator() = default;
+
+	    iterator(const ArgParse *parser, size_t idx)
+		: m_parser(parser)
+		, m_idx(idx)
+	    { skip(); }
+
+	    OptionView operator*() const
+	    { return m_parser->view(m_idx); }
+
+	    iterator& operator++()
+	    {
+		++m_idx;
+		skip();
+		return *this;
+	    }
+
+	    iterator operator++(int)
+	    {
+		auto r = *this;
+		++*this;
+		return r;
+	    }
+
+	    bool operator==(const iterator& other) const
+	    { return m_idx == other.m_idx; }
+
+	private:
+	    void skip()
+	    {
+		while (m_idx < Size and not m_parser->m_state.present.test(m_idx))
+		    ++m_idx;
+	    }
+	    
+	    const ArgParse *m_parser{nullptr};
+	    size_t m_idx{Size};
+	};
+
+	PresentOptions(const ArgParse& parser)
+	    : m_parser(parser)
+	{ }
+
+	iterator begin() const
+	{ return iterator(&m_parser, 0); }
+
+	iterator end() const
+	{ return iterator(&m_parser, Size); }
+
+    private:
+	const ArgParse& m_parser;
+    };
+
+    /// Iterate over views of the options that occurred.
+    PresentOptions present() const
+    { return PresentOptions(*this); }
+
+    /// Write the name, occurrence count, origin and value of every option
+    /// into `buffer` without allocating.
+    ///
+    /// Like snprintf, the output is cut off at the end of the buffer but
+    /// the length of the complete output is returned, so the caller can
+    /// retry with a larger buffer. No terminating null is written. Values
+    /// of types dump_value does not write directly go through
+    /// lexical_to_string, which may allocate.
+    ///
+    /// \param buffer The destination.
+    /// \param format JSON or key=value lines.
+    /// \returns The length of the complete output.
+    size_t dump(std::span<char> buffer, DumpFormat format = DumpFormat::Json) const
+    {
+	DumpWriter out(buffer);
+	if (format == DumpFormat::Json)
+	    out.put('{');
+	size_t idx{0};
+	m_tuple.for_each([&](const auto& e) { dump_option(out, e, idx++, format); });
+	if (format == DumpFormat::Json)
+	    out.put('}');
+	return out.size();
+    }
+
+    /// Bind the options that store their values in members of a caller-owned struct.
+    ///
+    /// \param target The struct whose members receive the parsed values.
+    /// \returns This parser.
+    template<class S>
+    ArgParse& bind(S& target)
+    {
+	m_tuple.for_each([&](auto& e) { e.storage.bind(target); });
+	return *this;
     }
 
-    void process_token(std::string_view token, Context& ctx)
+    void process_token(std::string_view token, Context& ctx,
+		       std::optional<std::string_view> attached = std::nullopt)
     {
-	using core::tp::find_first;
-	using core::tp::map_nth;
-		
-	auto idx = find_first(m_tuple, [&](const auto& e) { return e.matches(token); });
+	auto idx = find_option(token);
 
 	if (idx < 0)
+	    throw_unknown_option(token, ctx, m_long_names);
+	
+	auto matcher = [&](auto& e) { e.match(token, attached, ctx); };
+	dispatch(idx, matcher);
+	record(idx);
+    }
+
+    void process_long_option(std::string_view token, Context& ctx)
+    {
+	auto pos = token.find(ValueSymbol);
+	if (pos == std::string_view::npos) process_token(token, ctx);
+	else process_token(token.substr(0, pos), ctx, token.substr(pos + 1));
+    }
+
+    void process_group(std::string_view token, Context& ctx)
+    {
+	check_group(token, ctx);
+	for (size_t i = 1; i < token.size(); ++i)
 	{
-	    if (token == "-*") throw unknown_option_error(ctx.front(), ctx);
-	    else throw unknown_option_error(token, ctx);
+	    auto c = token[i];
+	    auto idx = is_identifier(c) ? FlagIndex[static_cast<unsigned char>(c)] : -1;
+	    if (idx < 0)
+		throw_unknown_flag(c, ctx);
+
+	    auto rest = token.substr(i + 1);
+	    auto matcher = [&](auto& e)
+		    {
+			using Option = std::decay_t<decltype(e)>;
+			if (Option::TakesValue and not rest.empty())
+			{
+			    e.match(Option::ShortName, rest, ctx);
+			    i = token.size();
+			}
+			else
+			    e.match(Option::ShortName, std::nullopt, ctx);
+		    };
+	    dispatch(idx, matcher);
+	    record(idx);
 	}
-	
-	map_nth([&](auto& e) { e.match(token, ctx); }, idx, m_tuple);
     }
 
     std::string star_value_spec()
     {
-	auto printer = [&](const auto& result, const auto& arg)
-		       {
-			   if (arg.FlagCharacter != '*')
-			       return result;
-			   return result + " " + arg.value_spec;
-		       };
-	return core::tp::fold_l(printer, std::string(), m_tuple);
+	std::string result;
+	for (const auto& entry : help_entries())
+	    if (entry.flag == '*')
+		result += " " + entry.value_spec;
+	return result;
     }
     
     void output_help_message(std::ostream& os, const std::vector<std::string>& args)
+    { write_help(os, args, help_entries()); }
+
+    /// Run the functors on `executor` while parsing continues.
+    ///
+    /// The functors of each option run one at a time and in the order the
+    /// option is matched, receiving copies of the values. parse waits for
+    /// every functor to finish and rethrows the first exception a functor
+    /// throws; Feeder::finish does the same.
+    ///
+    /// \param executor Runs the functor calls, for example ThreadPool::executor().
+    /// \returns This parser.
+    ArgParse& executor(Executor executor)
+    {
+	m_calls = std::make_shared<AsyncCalls>(std::move(executor), Size);
+	size_t idx{0};
+	m_tuple.for_each([&](auto& e) { e.strand = &m_calls->strand(idx++); });
+	return *this;
+    }
+
+    /// Bound the work done parsing, for command lines from untrusted sources.
+    ///
+    /// \param limits The limits, each of which raises its own limit_error.
+    /// \returns This parser.
+    ArgParse& limits(const Limits& limits)
     {
-	auto program_name = args.size() > 0 ? args[0] : "unknown program";
-	os << "program: " << program_name << " [options]" << star_value_spec() << std::endl;
-	auto printer = [&](const auto& arg)
-		       {
-			   static constexpr size_t Indent = 4;
-			   static constexpr size_t Align = 10;
-			   static constexpr size_t Info = 30;
-			   if (arg.FlagCharacter == '*')
-			       return;
-
-			   auto len = arg.long_name.size() + arg.value_spec.size();
-			   auto n = Align - len % Align;
-			   if (n + len < Info)
-			       n = Info - len;
-
-			   os << std::string(Indent, ' ');
-			   os << "-" << arg.FlagCharacter << ", ";
-			   os << "--" << arg.long_name << " ";
-			   os << arg.value_spec;
-			   os << std::string(n, ' ');
-			   os << arg.description << std::endl;
-		       };
-	core::tp::map_inplace(printer, m_tuple);
+	m_limits = limits;
+	return *this;
     }
 
     bool parse(const std::vector<std::string>& args)
     {
-	Context ctx{args};
-	ctx.pop();
-	
-	bool done_with_options{false};
-	while (not ctx.end())
+	try { parse_tokens(args); }
+	catch (...)
 	{
-	    const auto& token = ctx.front();
-	    if (done_with_options or token[0] != OptionSymbol)
-	    {
-		process_token("-*", ctx);
-	    }
-	    else if (ctx.front() == "--help")
-	    {
-		output_help_message(std::cout, args);
-		exit(0);
-	    }
-	    else if (is_option_separator(token))
-	    {
-		ctx.pop();
-		done_with_options = true;
-	    }
-	    else if (is_option(token))
-	    {
-		ctx.pop();
-		process_token(token, ctx);
-	    }
-	    else if (is_option_group(token))
-	    {
-		ctx.pop();
-		for (auto c : token.substr(1))
-		    process_token(std::string{'-', c}, ctx);
-	    }
-	    else
-		throw unknown_option_error(token, ctx);
+	    wait_quietly();
+	    throw;
 	}
-	
+	if (m_calls)
+	    m_calls->wait();
 	return true;
     }
     
@@ -174,22 +352,239 @@ public:
 	return parse(args);
     }
 
-    void parse_catch(const std::vector<std::string>& args) {
-	try {
-	    parse(args);
-	} catch (const std::exception& err) {
-	    std::cerr << "The following exception was caught by ArgParse:" << std::endl;
-	    std::cerr << err.what() << std::endl << std::endl;
-	    std::cerr << "The orignal command line:" << std::endl;
-	    for (const auto& arg : args)
-		std::cerr << arg << " ";
-	    std::cerr << std::endl << std::endl;
-	    std::cerr << "The command help message:" << std::endl;
-	    output_help_message(std::cerr, args);
-	    std::cerr << std::endl;
-	    std::cerr << "Exiting program with a return code of -1" << std::endl;
-	    exit(-1);
+    /// Parse the arguments, reusing the results cached by an earlier run.
+    ///
+    /// The cache is keyed by the arguments (excluding the program name), the
+    /// modification time and size of each dependency file and the option
+    /// signature. On a hit the values and counts are loaded from the cache
+    /// file and the functors are replayed; otherwise the arguments are parsed
+    /// and the results written to the cache. Failing to write the cache is
+    /// not an error.
+    ///
+    /// \note The functor of an ArgValues option is replayed once per stored
+    /// value. A set or map container stores each distinct value once, so
+    /// unlike a parse the functor does not see the duplicate tokens.
+    ///
+    /// \param cache_path The cache file.
+    /// \param args Arguments
+    /// \param dependencies Files whose contents influence the parse results.
+    /// \returns True if the results were loaded from the cache.
+    bool parse_cached(const std::string& cache_path, const std::vector<std::string>& args,
+		      const std::vector<std::string>& dependencies = {})
+    {
+	static_assert([]<class... Os>(std::type_identity<FlatTuple<Os...>>) {
+	    std::array<bool, sizeof...(Os)> ok = {
+		cacheable<std::decay_t<decltype(std::declval<Os&>().storage.ref())>>...
+	    };
+	    for (auto b : ok)
+		if (not b)
+		    return false;
+	    return true;
+	}(std::type_identity<Tuple>{}),
+		      "\n\nstatic assertion: Every option value must have cache_traits.\n");
+	
+	auto key = cache_key(std::span{args}.subspan(args.empty() ? 0 : 1), dependencies,
+			     cache_signature());
+	CacheReader reader;
+	if (reader.open(cache_path, key) and load_cache(reader))
+	{
+	    size_t idx{0};
+	    m_tuple.for_each([&](auto& e) { e.replay(m_state.counts[idx++]); });
+	    return true;
+	}
+
+	parse(args);
+	CacheWriter writer;
+	writer.write(m_state.counts.data(), sizeof(m_state.counts));
+	std::as_const(m_tuple).for_each([&](const auto& e) { save_value(writer, e.storage.ref()); });
+	writer.commit(cache_path, key);
+	return false;
+    }
+
+    /// Parses arguments pushed one token at a time.
+    ///
+    /// The tokens are interpreted as by parse, without the program name,
+    /// but each one is handled as soon as it arrives: the feeder keeps
+    /// the option awaiting values and passes each value to its functor
+    /// on arrival. Error messages show only the offending token.
+    class Feeder
+    {
+    public:
+	Feeder(ArgParse& parser)
+	    : m_parser(parser)
+	    , m_ctx(std::vector<std::string>{}, parser.m_limits, &FlagIndex)
+	{ m_parser.m_state.origin = Origin::CommandLine; }
+
+	/// Handle the next token.
+	void feed(std::string_view token)
+	{
+	    m_ctx.assign(token);
+	    if (m_values >= 0)
+	    {
+		if (m_done_with_options or not m_ctx.ends_values(token))
+		{
+		    push_value(token);
+		    return;
+		}
+		close_values();
+	    }
+	    
+	    if (m_value >= 0)
+		take_value(token);
+	    else if (m_done_with_options or token.empty() or token[0] != OptionSymbol)
+	    {
+		open("-*", std::nullopt);
+		if (m_values >= 0) push_value(token);
+		else if (m_value >= 0) take_value(token);
+	    }
+	    else if (token == "--help")
+	    {
+		exit_with_help({}, m_parser.help_entries());
+	    }
+	    else if (is_option_separator(token))
+		m_done_with_options = true;
+	    else if (is_long_option(token))
+	    {
+		auto pos = token.find(ValueSymbol);
+		if (pos == std::string_view::npos) open(token, std::nullopt);
+		else open(token.substr(0, pos), token.substr(pos + 1));
+	    }
+	    else if (is_short_option(token))
+		open(token, std::nullopt);
+	    else if (is_option_group(token))
+	    {
+		m_parser.check_group(token, m_ctx);
+		for (size_t i = 1; i < token.size() and m_value < 0; ++i)
+		{
+		    auto c = token[i];
+		    auto idx = is_identifier(c) ? FlagIndex[static_cast<unsigned char>(c)] : -1;
+		    if (idx < 0)
+			throw_unknown_flag(c, m_ctx);
+
+		    auto rest = token.substr(i + 1);
+		    const char name[] = { OptionSymbol, c };
+		    if (open(idx, std::string_view(name, sizeof(name)),
+			     rest.empty() ? std::nullopt : std::optional{rest}, true))
+			break;
+		}
+	    }
+	    else
+		throw_unknown_option(token, m_ctx);
+	}
+
+	/// Complete the parse after the last token.
+	void finish()
+	{
+	    try { close(); }
+	    catch (...)
+	    {
+		m_parser.wait_quietly();
+		throw;
+	    }
+	    if (m_parser.m_calls)
+		m_parser.m_calls->wait();
+	}
+
+    private:
+	void close()
+	{
+	    m_ctx.pop();
+	    if (m_values >= 0)
+		close_values();
+	    if (m_value >= 0)
+	    {
+		auto matcher = [&](auto& e) { e.match(m_name, std::nullopt, m_ctx); };
+		m_parser.dispatch(std::exchange(m_value, -1), matcher);
+	    }
+	    m_parser.check_constraints(m_ctx);
+	}
+	
+	// Begin an occurrence of the option named `token`.
+	bool open(std::string_view token, std::optional<std::string_view> attached)
+	{
+	    auto idx = m_parser.find_option(token);
+	    if (idx < 0)
+		throw_unknown_option(token, m_ctx, m_parser.m_long_names);
+	    return open(idx, token, attached);
+	}
+
+	// Begin an occurrence of option `idx`, named `token`. Returns true if
+	// the option takes `attached` as its value. Within a group, the rest
+	// of the group is only attached to an option that takes a value.
+	bool open(int idx, std::string_view token, std::optional<std::string_view> attached,
+		  bool group = false)
+	{
+	    bool consumed{false};
+	    auto opener = [&](auto& e)
+		    {
+			using Option = std::decay_t<decltype(e)>;
+			if constexpr (requires { e.open(); })
+			{
+			    e.open();
+			    m_values = idx;
+			    m_name.assign(token);
+			    if (attached)
+				push_value(*attached);
+			    consumed = attached.has_value();
+			}
+			else if (Option::TakesValue and not attached)
+			{
+			    m_value = idx;
+			    m_name.assign(token);
+			}
+			else
+			{
+			    e.match(token, group and not Option::TakesValue ? std::nullopt : attached, m_ctx);
+			    consumed = Option::TakesValue and attached;
+			}
+		    };
+	    m_parser.dispatch(idx, opener);
+	    m_parser.record(idx);
+	    return consumed;
+	}
+
+	void take_value(std::string_view token)
+	{
+	    auto matcher = [&](auto& e)
+		    { e.match(m_name, is_option(token) ? std::nullopt : std::optional{token}, m_ctx); };
+	    m_parser.dispatch(std::exchange(m_value, -1), matcher);
+	}
+
+	void push_value(std::string_view input)
+	{
+	    auto pusher = [&](auto& e)
+		    {
+			if constexpr (requires { e.open(); })
+			    e.push(m_name, input, m_ctx);
+		    };
+	    m_parser.dispatch(m_values, pusher);
+	}
+
+	void close_values()
+	{
+	    auto closer = [&](auto& e)
+		    {
+			if constexpr (requires { e.open(); })
+			    e.close(m_ctx);
+		    };
+	    m_parser.dispatch(std::exchange(m_values, -1), closer);
 	}
+	
+	ArgParse& m_parser;
+	Context m_ctx;
+	std::string m_name;
+	int m_value{-1}, m_values{-1};
+	bool m_done_with_options{false};
+    };
+
+    /// Start parsing arguments pushed one token at a time.
+    Feeder feeder()
+    { return Feeder(*this); }
+    
+    void parse_catch(const std::vector<std::string>& args)
+    {
+	try { parse(args); }
+	catch (const std::exception& err) { exit_with_error(err, args, help_entries()); }
     }
 
     void parse_catch(std::initializer_list<std::string> largs)
@@ -207,8 +602,262 @@ public:
     }
 
 private:
+    void parse_tokens(const std::vector<std::string>& args)
+    {
+	Context ctx{args, m_limits, &FlagIndex};
+	ctx.pop();
+	m_state.origin = Origin::CommandLine;
+	
+	bool done_with_options{false};
+	while (not ctx.end())
+	{
+	    const auto& token = ctx.front();
+	    if (done_with_options or token[0] != OptionSymbol)
+	    {
+		process_token("-*", ctx);
+	    }
+	    else if (ctx.front() == "--help")
+	    {
+		exit_with_help(args, help_entries());
+	    }
+	    else if (is_option_separator(token))
+	    {
+		ctx.pop();
+		done_with_options = true;
+	    }
+	    else if (is_long_option(token))
+	    {
+		ctx.pop();
+		process_long_option(token, ctx);
+	    }
+	    else if (is_short_option(token))
+	    {
+		ctx.pop();
+		process_token(token, ctx);
+	    }
+	    else if (is_option_group(token))
+	    {
+		ctx.pop();
+		process_group(token, ctx);
+	    }
+	    else
+		throw_unknown_option(token, ctx);
+	}
+
+	check_constraints(ctx);
+    }
+
+    // The help message is only needed on the way out, so collecting it is
+    // kept cold and out of line, away from the parse loop.
+    [[gnu::cold, gnu::noinline]]
+    std::array<HelpEntry, Size> help_entries() const
+    {
+	return m_tuple.apply([](const auto&... e) {
+	    return std::array<HelpEntry, Size>{
+		HelpEntry{ e.FlagCharacter, e.long_name, e.value_spec(), e.description }...
+	    };
+	});
+    }
+
+    // Wait for the functors after a parse error, which takes precedence
+    // over their exceptions.
+    void wait_quietly()
+    {
+	if (m_calls)
+	    try { m_calls->wait(); } catch (...) { }
+    }
+
+    void check_group(std::string_view token, const Context& ctx) const
+    {
+	if (token.size() - 1 > m_limits.max_group)
+	    throw_group_limit(token, ctx, m_limits.max_group);
+    }
+
+    int find_option(std::string_view token) const
+    {
+	if (token.size() == 2 and token[0] == OptionSymbol)
+	    return FlagIndex[static_cast<unsigned char>(token[1])];
+	if (token.size() > 2 and token[0] == OptionSymbol and token[1] == OptionSymbol)
+	    return m_name_index.find(token.substr(2), m_long_names);
+	return -1;
+    }
+
+    template<class Option>
+    void dump_option(DumpWriter& out, const Option& e, size_t idx, DumpFormat format) const
+    {
+	auto count = m_state.counts[idx];
+	auto origin = origin_name(count > 0 ? m_state.origin : Origin::Default);
+	if (format == DumpFormat::Json)
+	{
+	    if (idx > 0)
+		out.put(',');
+	    out.string(e.long_name, format);
+	    out.put(":{\"count\":");
+	    out.number(count);
+	    out.put(",\"origin\":\"");
+	    out.put(origin);
+	    out.put("\",\"value\":");
+	    dump_value(out, e.storage.ref(), format);
+	    out.put('}');
+	}
+	else
+	{
+	    out.put("name=");
+	    out.string(e.long_name, format);
+	    out.put(" count=");
+	    out.number(count);
+	    out.put(" origin=");
+	    out.put(origin);
+	    out.put(" value=");
+	    dump_value(out, e.storage.ref(), format);
+	    out.put('\n');
+	}
+    }
+
+    static int flag_index(char c)
+    { return FlagIndex[static_cast<unsigned char>(c)]; }
+
+    OptionView view(size_t idx) const
+    {
+	OptionView r;
+	auto viewer = [&](const auto& e) {
+	    r = OptionView(e.long_name, e.FlagCharacter, m_state.counts[idx], e.storage.ref());
+	};
+	option_list<Tuple>::dispatch(m_tuple, idx, viewer);
+	return r;
+    }
+
+    void record(size_t idx)
+    {
+	++m_state.counts[idx];
+	m_state.present.set(idx);
+    }
+    
+    template<class Refs, size_t... Is>
+    static constexpr Tuple make_options(Refs&& refs, std::index_sequence<Is...>)
+    { return Tuple(std::move(refs.template get<OptionPositions[Is]>())...); }
+
+    template<class F>
+    void dispatch(size_t idx, F& func)
+    { option_list<Tuple>::dispatch(m_tuple, idx, func); }
+
+    template<char C>
+    static constexpr size_t index_of()
+    {
+	constexpr auto Idx = FlagIndex[static_cast<unsigned char>(C)];
+	static_assert(Idx >= 0, "\n\n"
+		      "static assertion: A constraint names an option that does not exist.\n");
+	return Idx;
+    }
+
+    template<char... Cs>
+    static constexpr OptionSet<Size> mask()
+    {
+	OptionSet<Size> r;
+	(r.set(index_of<Cs>()), ...);
+	return r;
+    }
+
+    std::string option_name(size_t idx)
+    {
+	return std::string(2, OptionSymbol) + std::string(m_long_names[idx]);
+    }
+    
+    template<char A, char... Bs>
+    void check(Constraint<ConstraintKind::Requires, A, Bs...>, const Context& ctx)
+    {
+	constexpr auto Required = mask<Bs...>();
+	if (not m_state.present.test(index_of<A>()) or (m_state.present & Required) == Required)
+	    return;
+	for (auto idx : { index_of<Bs>()... })
+	    if (not m_state.present.test(idx))
+		throw requires_error(option_name(index_of<A>()), option_name(idx), ctx);
+    }
+
+    template<char... Cs>
+    void check(Constraint<ConstraintKind::Conflicts, Cs...>, const Context& ctx)
+    {
+	constexpr auto Exclusive = mask<Cs...>();
+	if ((m_state.present & Exclusive).count() <= 1)
+	    return;
+	std::vector<std::string> names;
+	for (auto idx : { index_of<Cs>()... })
+	    if (m_state.present.test(idx))
+		names.push_back(option_name(idx));
+	throw conflicts_error(names[0], names[1], ctx);
+    }
+
+    template<char... Cs>
+    void check(Constraint<ConstraintKind::OneOf, Cs...>, const Context& ctx)
+    {
+	constexpr auto Alternatives = mask<Cs...>();
+	auto count = (m_state.present & Alternatives).count();
+	if (count == 1)
+	    return;
+	std::string names;
+	for (auto idx : { index_of<Cs>()... })
+	    names += (names.empty() ? "" : ", ") + option_name(idx);
+	throw one_of_error(names, count, ctx);
+    }
+
+    std::string cache_signature() const
+    {
+	std::string signature = typeid(Tuple).name();
+	for (auto name : m_long_names)
+	    (signature += ' ') += name;
+	return signature;
+    }
+
+    template<class T>
+    static void save_value(CacheWriter& writer, const T& value)
+    { cache_traits<T>::save(writer, value); }
+
+    bool load_cache(CacheReader& reader)
+    {
+	OptionState<Size> state;
+	if (not reader.read(state.counts.data(), sizeof(state.counts)))
+	    return false;
+	for (size_t idx = 0; idx < Size; ++idx)
+	    if (state.counts[idx] > 0)
+		state.present.set(idx);
+	state.origin = Origin::Cache;
+
+	// Load every value before storing any, so a cache rejected partway
+	// leaves the options untouched for the parse that replaces it.
+	return [&]<class... Os>(std::type_identity<FlatTuple<Os...>>) {
+	    FlatTuple<value_type_of<Os>...> values(value_type_of<Os>{}...);
+	    return [&]<size_t... Is>(std::index_sequence<Is...>) {
+		if (not (load_value(reader, values.template get<Is>()) and ...) or not reader.done())
+		    return false;
+		((m_tuple.template get<Is>().storage.ref() = std::move(values.template get<Is>())), ...);
+		m_state = state;
+		return true;
+	    }(std::make_index_sequence<Size>{});
+	}(std::type_identity<Tuple>{});
+    }
+
+    template<class O>
+    using value_type_of = std::decay_t<decltype(std::declval<O&>().storage.ref())>;
+
+    template<class T>
+    static bool load_value(CacheReader& reader, T& value)
+    { return cache_traits<T>::load(reader, value); }
+
+    void check_constraints(const Context& ctx)
+    {
+	std::apply([&](auto... constraint) { (check(constraint, ctx), ...); }, Constraints{});
+    }
+
+    // Parse results are packed together and the match table is kept apart
+    // from the option objects, so the parse loop only touches the option
+    // it dispatches to. The descriptions are only read by the help message.
+    OptionState<Size> m_state;
     Tuple m_tuple;
+    std::array<std::string_view, Size> m_long_names;
+    NameIndex<Size> m_name_index;
     std::vector<std::string> m_extra;
+    std::shared_ptr<AsyncCalls> m_calls;
+    Limits m_limits;
 };
 
 }; // core::argp
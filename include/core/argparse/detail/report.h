@@ -0,0 +1,42 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <exception>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core::argp
+{
+
+/// The help message line of one option.
+struct HelpEntry
+{
+    char flag;
+    std::string_view long_name;
+    std::string value_spec;
+    std::string_view description;
+};
+
+/// Write the help message for the options described by `entries`.
+///
+/// \param os The destination.
+/// \param args The arguments, whose first is the program name.
+/// \param entries The options in declaration order.
+[[gnu::cold]]
+void write_help(std::ostream& os, const std::vector<std::string>& args, std::span<const HelpEntry> entries);
+
+/// Write the help message to std::cout and exit successfully, as for `--help`.
+[[noreturn, gnu::cold]]
+void exit_with_help(const std::vector<std::string>& args, std::span<const HelpEntry> entries);
+
+/// Report `err`, the arguments and the help message on std::cerr, then
+/// exit with a return code of -1.
+[[noreturn, gnu::cold]]
+void exit_with_error(const std::exception& err, const std::vector<std::string>& args,
+		     std::span<const HelpEntry> entries);
+
+}; // core::argp
@@ -0,0 +1,68 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace core::argp
+{
+
+/// A fixed-size set of option indices packed into 64-bit words.
+///
+/// \tparam N The number of options.
+template<size_t N>
+struct OptionSet
+{
+    static constexpr size_t Bits = 64;
+    static constexpr size_t Words = N == 0 ? 1 : (N + Bits - 1) / Bits;
+
+    constexpr void set(size_t idx)
+    { words[idx / Bits] |= uint64_t{1} << (idx % Bits); }
+
+    constexpr bool test(size_t idx) const
+    { return words[idx / Bits] & (uint64_t{1} << (idx % Bits)); }
+
+    constexpr size_t count() const
+    {
+	size_t n{0};
+	for (auto word : words)
+	    n += std::popcount(word);
+	return n;
+    }
+
+    constexpr OptionSet operator&(const OptionSet& other) const
+    {
+	OptionSet r;
+	for (size_t i = 0; i < Words; ++i)
+	    r.words[i] = words[i] & other.words[i];
+	return r;
+    }
+
+    constexpr bool operator==(const OptionSet&) const = default;
+    
+    std::array<uint64_t, Words> words{};
+};
+
+/// Where the values of the options that occurred came from.
+enum class Origin
+{
+    Default,
+    CommandLine,
+    Cache
+};
+
+/// Parse results for every option, packed contiguously for the parse loop.
+///
+/// \tparam N The number of options.
+template<size_t N>
+struct OptionState
+{
+    std::array<size_t, N> counts{};
+    OptionSet<N> present;
+    Origin origin{Origin::CommandLine};
+};
+
+}; // core::argp
@@ -0,0 +1,25 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core::argp
+{
+
+/// The Levenshtein distance between `a` and `b`.
+///
+/// When the shorter string fits in a machine word the distance is computed
+/// with the bit-parallel algorithm of Myers as formulated by Hyyrö, which
+/// takes time linear in the length of the longer string.
+size_t edit_distance(std::string_view a, std::string_view b);
+
+/// The names closest to `token`, nearest first, among those within a small
+/// edit distance relative to the name length.
+std::vector<std::string> suggest(std::string_view token, std::span<const std::string_view> names,
+				 size_t max_suggestions = 3);
+
+}; // core::argp
@@ -0,0 +1,158 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "core/lexical_cast/builtin.h"
+#include "core/lexical_cast/error.h"
+
+namespace core::argp {
+
+/// A string literal usable as a template argument, as in `Enum<Algo, "lz4", "zstd">`.
+template<size_t N>
+struct FixedString {
+    constexpr FixedString(const char (&s)[N]) {
+	std::copy_n(s, N, data);
+    }
+
+    constexpr std::string_view view() const {
+	return {data, N - 1};
+    }
+
+    char data[N];
+};
+
+/// A table mapping each of `names` to its position with a single probe.
+///
+/// The hash seed and table size are searched for at compile time until no
+/// two names share a slot, so a lookup hashes the token, reads one slot
+/// and compares one name.
+template<size_t N>
+class PerfectHash {
+public:
+    static constexpr uint8_t Empty = 0xff;
+    static_assert(N < Empty, "PerfectHash holds fewer than 255 names");
+
+    constexpr PerfectHash(const std::array<std::string_view, N>& names) {
+	for (size_t size = std::bit_ceil(std::max<size_t>(N, 1)); ; size *= 2)
+	    for (uint32_t seed = 0; seed < 1024; ++seed)
+		if (build(names, seed, size))
+		    return;
+    }
+
+    /// The position of `token` in `names`, or -1 if it is not one of them.
+    constexpr int find(std::string_view token, const std::array<std::string_view, N>& names) const {
+	auto idx = slots_[hash(token, seed_) & (size_ - 1)];
+	return idx != Empty and names[idx] == token ? idx : -1;
+    }
+
+private:
+    static constexpr size_t MaxSlots = 16 * std::bit_ceil(std::max<size_t>(N, 1));
+
+    static constexpr uint32_t hash(std::string_view s, uint32_t seed) {
+	uint32_t h = 0x811c9dc5 ^ seed;
+	for (auto c : s)
+	    h = (h ^ static_cast<unsigned char>(c)) * 0x01000193;
+	return h ^ (h >> 15);
+    }
+
+    constexpr bool build(const std::array<std::string_view, N>& names, uint32_t seed, size_t size) {
+	if (size > MaxSlots)
+	    throw "PerfectHash: no perfect hash found; the names may not be distinct";
+	slots_.fill(Empty);
+	for (size_t idx = 0; idx < N; ++idx) {
+	    auto& slot = slots_[hash(names[idx], seed) & (size - 1)];
+	    if (slot != Empty)
+		return false;
+	    slot = idx;
+	}
+	seed_ = seed;
+	size_ = size;
+	return true;
+    }
+
+    std::array<uint8_t, MaxSlots> slots_{};
+    uint32_t seed_{0};
+    size_t size_{1};
+};
+
+}; // core::argp
+
+/// An enumeration given by name on the command line, as in `--algo zstd`.
+///
+/// The `i`th name maps to the enumerator whose underlying value is `i`.
+/// The help message lists the names as the choices for the option, and
+/// any other token is a bad value.
+///
+/// \tparam E The enumeration type.
+/// \tparam Names The names of the enumerators in order of their values.
+template<class E, core::argp::FixedString... Names>
+requires std::is_enum_v<E>
+class Enum {
+public:
+    using enum_type = E;
+    static constexpr std::array<std::string_view, sizeof...(Names)> Choices = { Names.view()... };
+    static constexpr core::argp::PerfectHash<sizeof...(Names)> Index{Choices};
+
+    Enum(E value = E{})
+	: value_(value) {
+    }
+
+    operator E() const {
+	return value_;
+    }
+
+    E value() const {
+	return value_;
+    }
+
+    /// The name of the value, or an empty view for an enumerator whose
+    /// value is outside 0..N-1 and so has no name.
+    std::string_view name() const {
+	auto idx = static_cast<size_t>(value_);
+	return idx < Choices.size() ? Choices[idx] : std::string_view{};
+    }
+
+    /// The parameter name shown in the help message: the choices.
+    static std::string spec_name() {
+	std::string r;
+	for (auto choice : Choices)
+	    (r += r.empty() ? "" : "|") += choice;
+	return r;
+    }
+
+    bool operator==(const Enum& other) const = default;
+
+    bool operator==(E other) const {
+	return value_ == other;
+    }
+
+private:
+    E value_;
+};
+
+namespace core::lexical_cast_detail {
+
+template<class E, core::argp::FixedString... Names>
+struct lexical_cast_impl<Enum<E, Names...>> {
+    using Type = Enum<E, Names...>;
+
+    Type convert(std::string_view s) const {
+	auto idx = Type::Index.find(s, Type::Choices);
+	if (idx < 0)
+	    throw lexical_cast_error(s, Type::spec_name());
+	return static_cast<E>(idx);
+    }
+
+    std::string to_string(const Type& value) const {
+	return std::string(value.name());
+    }
+};
+
+};
@@ -0,0 +1,206 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "core/lexical_cast/builtin.h"
+#include "core/lexical_cast/error.h"
+
+/// A list of values given as a single separated token, as in `--weights 0.1,0.25,0.5`.
+///
+/// Plain arithmetic elements are parsed in a single pass, each conversion
+/// stopping at the next separator; plain decimals take the exact fast
+/// path of parse_plain_decimal and everything else std::from_chars. Other elements,
+/// such as IntegerWithSuffix or FloatingWithSuffix, are found with memchr
+/// and converted with their lexical_cast. Either way the values are
+/// written into one buffer sized by counting the separators first.
+///
+/// \tparam T The element type.
+/// \tparam Sep The separator.
+template<class T, char Sep = ','>
+class List {
+public:
+    using value_type = T;
+    using const_iterator = typename std::vector<T>::const_iterator;
+    static constexpr char Separator = Sep;
+
+    List() = default;
+
+    List(std::vector<T> values)
+	: values_(std::move(values)) {
+    }
+
+    List(std::initializer_list<T> values)
+	: values_(values) {
+    }
+
+    size_t size() const {
+	return values_.size();
+    }
+
+    bool empty() const {
+	return values_.empty();
+    }
+
+    const T& operator[](size_t idx) const {
+	return values_[idx];
+    }
+
+    const T *data() const {
+	return values_.data();
+    }
+
+    const_iterator begin() const {
+	return values_.begin();
+    }
+
+    const_iterator end() const {
+	return values_.end();
+    }
+
+    const std::vector<T>& values() const {
+	return values_;
+    }
+
+    bool operator==(const List& other) const = default;
+
+private:
+    std::vector<T> values_;
+};
+
+namespace core::lexical_cast_detail {
+
+// Append the decimal digits starting at `p` to `mantissa`, eight at a
+// time while they last, as in fast_float.
+inline const char *parse_digits(const char *p, const char *end, uint64_t& mantissa) {
+    while (end - p >= 8) {
+	uint64_t chunk;
+	std::memcpy(&chunk, p, sizeof(chunk));
+	if constexpr (std::endian::native == std::endian::big)
+	    chunk = __builtin_bswap64(chunk);
+	if ((((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) & 0x8080808080808080) != 0)
+	    break;
+	chunk -= 0x3030303030303030;
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FF) * 0x000F424000000064)
+		 + (((chunk >> 16) & 0x000000FF000000FF) * 0x0000271000000001)) >> 32;
+	mantissa = 100'000'000 * mantissa + chunk;
+	p += 8;
+    }
+    for (; p != end and unsigned(*p - '0') < 10; ++p)
+	mantissa = 10 * mantissa + unsigned(*p - '0');
+    return p;
+}
+
+/// Parse a plain decimal such as `-12.375` from `[ptr, end)` into `value`.
+///
+/// This is the fast path of fast_float: when the digits fit exactly in
+/// the mantissa and the power of ten is exact, one division is correctly
+/// rounded. Returns false, leaving `ptr` alone, for anything else, such
+/// as exponents, special values or too many digits.
+template<std::floating_point T>
+bool parse_plain_decimal(const char*& ptr, const char *end, T& value) {
+    static constexpr T Powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+	1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    static constexpr int MaxPower = std::is_same_v<T, float> ? 10 : 22;
+    static constexpr uint64_t MaxMantissa = uint64_t{1} << std::numeric_limits<T>::digits;
+
+    auto p = ptr;
+    bool negative = p != end and *p == '-';
+    p += negative;
+    
+    uint64_t mantissa{0};
+    auto start = p;
+    p = parse_digits(p, end, mantissa);
+    int digits = p - start, fraction{0};
+    if (p != end and *p == '.') {
+	auto fstart = ++p;
+	p = parse_digits(p, end, mantissa);
+	fraction = p - fstart;
+	digits += fraction;
+    }
+
+    if (digits == 0 or digits > 19 or fraction > MaxPower or mantissa > MaxMantissa
+	or (p != end and (*p == 'e' or *p == 'E')))
+	return false;
+
+    value = T(mantissa) / Powers[fraction];
+    if (negative)
+	value = -value;
+    ptr = p;
+    return true;
+}
+
+template<class T, char Sep>
+struct lexical_cast_impl<List<T,Sep>> {
+    static constexpr bool Direct = std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+
+    List<T,Sep> convert(std::string_view s) const {
+	if (s.empty())
+	    return {};
+
+	std::vector<T> values(std::count(s.begin(), s.end(), Sep) + 1);
+	auto out = values.data();
+	const char *ptr = s.data(), *end = s.data() + s.size();
+	if constexpr (Direct) {
+	    while (true) {
+		if constexpr (std::is_floating_point_v<T>) {
+		    if (not parse_plain_decimal(ptr, end, *out)) {
+			auto r = std::from_chars(ptr, end, *out);
+			if (r.ec != std::errc{})
+			    throw lexical_cast_error(s, "List");
+			ptr = r.ptr;
+		    }
+		    ++out;
+		}
+		else {
+		    auto r = std::from_chars(ptr, end, *out++);
+		    if (r.ec != std::errc{})
+			throw lexical_cast_error(s, "List");
+		    ptr = r.ptr;
+		}
+		if (ptr == end)
+		    break;
+		if (*ptr != Sep)
+		    throw lexical_cast_error(s, "List");
+		++ptr;
+	    }
+	}
+	else {
+	    try {
+		while (true) {
+		    auto next = static_cast<const char*>(std::memchr(ptr, Sep, end - ptr));
+		    *out++ = lexical_cast_impl<T>{}.convert(std::string_view(ptr, next ? next : end));
+		    if (not next)
+			break;
+		    ptr = next + 1;
+		}
+	    } catch (const lexical_cast_error&) {
+		throw lexical_cast_error(s, "List");
+	    }
+	}
+	return values;
+    }
+
+    std::string to_string(const List<T,Sep>& value) const {
+	std::string r;
+	for (size_t i = 0; i < value.size(); ++i) {
+	    if (i > 0)
+		r += Sep;
+	    r += lexical_cast_impl<T>{}.to_string(value[i]);
+	}
+	return r;
+    }
+};
+
+};
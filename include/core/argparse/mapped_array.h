@@ -0,0 +1,131 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include "core/lexical_cast/string.h"
+#include "core/lexical_cast/error.h"
+
+namespace core::argp {
+
+/// A read-only memory mapping of an entire file.
+class MappedFile {
+public:
+    /// Map the file at `path`, throwing std::system_error on failure.
+    MappedFile(std::string_view path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const std::byte *data() const {
+	return data_;
+    }
+
+    size_t size() const {
+	return size_;
+    }
+
+    const std::string& path() const {
+	return path_;
+    }
+
+private:
+    std::string path_;
+    const std::byte *data_{nullptr};
+    size_t size_{0};
+};
+
+}; // core::argp
+
+/// A read-only array of trivially copyable values backed by a memory mapped file.
+///
+/// On the command line the file is named with a leading `@`, as in
+/// `--weights @weights.f64`. The file must contain a whole number of
+/// values in native representation; no parsing or copying takes place.
+template<class T>
+class MappedArray {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "MappedArray requires a trivially copyable type");
+    
+    MappedArray() = default;
+
+    MappedArray(std::shared_ptr<const core::argp::MappedFile> file)
+	: file_(std::move(file))
+	, values_(reinterpret_cast<const T*>(file_->data()), file_->size() / sizeof(T)) {
+    }
+
+    operator std::span<const T>() const {
+	return values_;
+    }
+
+    std::span<const T> span() const {
+	return values_;
+    }
+
+    const T *data() const {
+	return values_.data();
+    }
+
+    size_t size() const {
+	return values_.size();
+    }
+
+    bool empty() const {
+	return values_.empty();
+    }
+
+    auto begin() const {
+	return values_.begin();
+    }
+
+    auto end() const {
+	return values_.end();
+    }
+
+    const T& operator[](size_t idx) const {
+	return values_[idx];
+    }
+
+    std::string path() const {
+	return file_ ? file_->path() : std::string{};
+    }
+
+private:
+    std::shared_ptr<const core::argp::MappedFile> file_;
+    std::span<const T> values_;
+};
+
+namespace core::lexical_cast_detail {
+
+template<class T>
+struct lexical_cast_impl<MappedArray<T>> {
+    MappedArray<T> convert(std::string_view s) const {
+	if (s.size() < 2 or s[0] != '@')
+	    throw lexical_cast_error(s, "MappedArray");
+	
+	std::shared_ptr<const core::argp::MappedFile> file;
+	try {
+	    file = std::make_shared<const core::argp::MappedFile>(s.substr(1));
+	} catch (std::system_error const&) {
+	    throw lexical_cast_error(s, "MappedArray");
+	}
+
+	if (file->size() % sizeof(T) != 0
+	    or reinterpret_cast<std::uintptr_t>(file->data()) % alignof(T) != 0)
+	    throw lexical_cast_error(s, "MappedArray");
+	return MappedArray<T>{std::move(file)};
+    }
+
+    std::string to_string(const MappedArray<T>& value) const {
+	return "@" + value.path();
+    }
+};
+
+};
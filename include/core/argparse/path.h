@@ -0,0 +1,167 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include "core/lexical_cast/string.h"
+#include "core/lexical_cast/error.h"
+#include "core/argparse/detail/container.h"
+
+/// The checks a Path performs when it is parsed.
+struct PathCheck {
+    static constexpr unsigned Exists = 1;
+    static constexpr unsigned File = 2;
+    static constexpr unsigned Directory = 4;
+    static constexpr unsigned Readable = 8;
+    static constexpr unsigned Writable = 16;
+    static constexpr unsigned Executable = 32;
+    /// Open the path read-only and keep the file descriptor.
+    static constexpr unsigned Open = 64;
+};
+
+namespace core::argp {
+
+/// An owned file descriptor, closed on destruction.
+class FileDescriptor {
+public:
+    explicit FileDescriptor(int fd)
+	: fd_(fd) {
+    }
+    
+    ~FileDescriptor();
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int get() const {
+	return fd_;
+    }
+
+private:
+    int fd_;
+};
+
+/// The outcome of checking one path: an errno value, the metadata and,
+/// when requested, the open file.
+struct PathProbe {
+    int error{0};
+    struct statx metadata{};
+    std::shared_ptr<const FileDescriptor> file;
+};
+
+/// Perform `checks` (a combination of PathCheck values) on `path`.
+PathProbe probe_path(const std::string& path, unsigned checks);
+
+/// Probes a run of paths in parallel on a shared pool of I/O threads.
+///
+/// The probes start on construction, so they overlap with the conversion
+/// of earlier values; take() waits only for the probe it returns. Probes
+/// that are never taken are abandoned when the prefetch is destroyed.
+class PathPrefetch {
+public:
+    PathPrefetch(std::span<const std::string> paths, unsigned checks);
+    ~PathPrefetch();
+
+    PathPrefetch(const PathPrefetch&) = delete;
+    PathPrefetch& operator=(const PathPrefetch&) = delete;
+
+    /// Wait for and return the probe of the `idx`th path.
+    PathProbe take(size_t idx);
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+}; // core::argp
+
+/// A path validated when it is parsed.
+///
+/// When parsed as the values of an argValues option, the paths of an
+/// occurrence are checked in parallel while earlier ones are converted.
+///
+/// \tparam Checks A combination of PathCheck values.
+template<unsigned Checks = PathCheck::Exists>
+class Path {
+public:
+    Path() = default;
+
+    Path(std::string path, core::argp::PathProbe probe)
+	: path_(std::move(path))
+	, probe_(std::move(probe)) {
+    }
+
+    const std::string& path() const {
+	return path_;
+    }
+
+    operator const std::string&() const {
+	return path_;
+    }
+
+    /// The metadata from statx.
+    const struct statx& metadata() const {
+	return probe_.metadata;
+    }
+
+    uint64_t size() const {
+	return probe_.metadata.stx_size;
+    }
+
+    /// The read-only file descriptor, or -1 unless PathCheck::Open was requested.
+    int fd() const {
+	return probe_.file ? probe_.file->get() : -1;
+    }
+
+    bool operator==(const Path& other) const {
+	return path_ == other.path_;
+    }
+
+private:
+    std::string path_;
+    core::argp::PathProbe probe_;
+};
+
+namespace core::argp {
+
+template<unsigned Checks>
+struct prefetch_traits<Path<Checks>> {
+    static constexpr bool Enabled = true;
+    using Batch = PathPrefetch;
+
+    static PathPrefetch start(std::span<const std::string> inputs) {
+	return PathPrefetch(inputs, Checks);
+    }
+
+    static Path<Checks> convert(PathPrefetch& batch, size_t idx, std::string_view input) {
+	auto probe = batch.take(idx);
+	if (probe.error != 0)
+	    throw lexical_cast_error(input, "Path");
+	return Path<Checks>{std::string(input), std::move(probe)};
+    }
+};
+
+}; // core::argp
+
+namespace core::lexical_cast_detail {
+
+template<unsigned Checks>
+struct lexical_cast_impl<Path<Checks>> {
+    Path<Checks> convert(std::string_view s) const {
+	auto path = std::string(s);
+	auto probe = core::argp::probe_path(path, Checks);
+	if (probe.error != 0)
+	    throw lexical_cast_error(s, "Path");
+	return Path<Checks>{std::move(path), std::move(probe)};
+    }
+
+    std::string to_string(const Path<Checks>& value) const {
+	return value.path();
+    }
+};
+
+};
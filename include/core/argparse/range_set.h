@@ -0,0 +1,257 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "core/lexical_cast/integral.h"
+#include "core/lexical_cast/error.h"
+
+/// A set of integers described by a list of strided intervals.
+///
+/// On the command line a range set is a comma separated list of
+/// items, where each item is a single value `a`, an inclusive range
+/// `a-b` or an inclusive strided range `a-b:s`, as in
+/// `0-99999:4,200000-300000`. The elements are never expanded; size,
+/// indexing and membership are computed from the intervals, which are
+/// kept sorted and must not overlap.
+template<std::integral T>
+class RangeSet {
+    using U = std::make_unsigned_t<T>;
+    
+public:
+    /// `count` elements starting at `start` and separated by `step`.
+    struct Interval {
+	T start;
+	U step;
+	size_t count;
+
+	T last() const {
+	    return T(U(start) + U(count - 1) * step);
+	}
+
+	T operator[](size_t idx) const {
+	    return T(U(start) + U(idx) * step);
+	}
+    };
+
+    class iterator {
+    public:
+	using value_type = T;
+	using difference_type = std::ptrdiff_t;
+	
+	iterator() = default;
+	iterator(const RangeSet *set, size_t interval, size_t idx)
+	    : set_(set)
+	    , interval_(interval)
+	    , idx_(idx) {
+	}
+
+	T operator*() const {
+	    return set_->intervals_[interval_][idx_];
+	}
+
+	iterator& operator++() {
+	    if (++idx_ == set_->intervals_[interval_].count) {
+		++interval_;
+		idx_ = 0;
+	    }
+	    return *this;
+	}
+
+	iterator operator++(int) {
+	    auto tmp = *this;
+	    ++*this;
+	    return tmp;
+	}
+
+	bool operator==(const iterator&) const = default;
+
+    private:
+	const RangeSet *set_{nullptr};
+	size_t interval_{0}, idx_{0};
+    };
+    
+    RangeSet() = default;
+
+    /// Construct from intervals, throwing std::invalid_argument if they overlap or
+    /// the total size overflows.
+    RangeSet(std::vector<Interval> intervals)
+	: intervals_(std::move(intervals)) {
+	std::erase_if(intervals_, [](const Interval& i) { return i.count == 0; });
+	std::sort(intervals_.begin(), intervals_.end(), [](const Interval& a, const Interval& b) {
+	    return a.start < b.start;
+	});
+	
+	offsets_.reserve(intervals_.size());
+	for (size_t i = 0; i < intervals_.size(); ++i) {
+	    if (i > 0 and intervals_[i - 1].last() >= intervals_[i].start)
+		throw std::invalid_argument("RangeSet: overlapping intervals");
+	    if (intervals_[i].count > std::numeric_limits<size_t>::max() - size_)
+		throw std::invalid_argument("RangeSet: too many elements");
+	    offsets_.push_back(size_);
+	    size_ += intervals_[i].count;
+	}
+    }
+
+    size_t size() const {
+	return size_;
+    }
+
+    bool empty() const {
+	return size_ == 0;
+    }
+
+    iterator begin() const {
+	return iterator{this, 0, 0};
+    }
+
+    iterator end() const {
+	return iterator{this, intervals_.size(), 0};
+    }
+
+    const std::vector<Interval>& intervals() const {
+	return intervals_;
+    }
+
+    /// The `idx`th smallest element.
+    T operator[](size_t idx) const {
+	auto i = interval_of(idx);
+	return intervals_[i][idx - offsets_[i]];
+    }
+
+    bool contains(T value) const {
+	auto iter = std::upper_bound(intervals_.begin(), intervals_.end(), value,
+				     [](T v, const Interval& i) { return v < i.start; });
+	if (iter == intervals_.begin())
+	    return false;
+	const auto& interval = *--iter;
+	auto distance = U(value) - U(interval.start);
+	return distance % interval.step == 0 and distance / interval.step < interval.count;
+    }
+
+    /// The elements with indices in `[first, first + count)`.
+    RangeSet slice(size_t first, size_t count) const {
+	std::vector<Interval> result;
+	count = std::min(count, first < size_ ? size_ - first : 0);
+	while (count > 0) {
+	    auto i = interval_of(first);
+	    auto offset = first - offsets_[i];
+	    auto n = std::min(count, intervals_[i].count - offset);
+	    result.push_back({intervals_[i][offset], intervals_[i].step, n});
+	    first += n;
+	    count -= n;
+	}
+	return RangeSet{std::move(result)};
+    }
+
+    /// The `idx`th of `nchunks` contiguous chunks of nearly equal size,
+    /// throwing std::invalid_argument if `nchunks` is zero.
+    RangeSet chunk(size_t idx, size_t nchunks) const {
+	if (nchunks == 0)
+	    throw std::invalid_argument("RangeSet: zero chunks");
+	auto base = size_ / nchunks, extra = size_ % nchunks;
+	auto first = idx * base + std::min(idx, extra);
+	return slice(first, base + (idx < extra ? 1 : 0));
+    }
+
+    /// Split into `nchunks` contiguous chunks of nearly equal size,
+    /// throwing std::invalid_argument if `nchunks` is zero.
+    std::vector<RangeSet> split(size_t nchunks) const {
+	if (nchunks == 0)
+	    throw std::invalid_argument("RangeSet: zero chunks");
+	std::vector<RangeSet> result;
+	result.reserve(nchunks);
+	for (size_t i = 0; i < nchunks; ++i)
+	    result.push_back(chunk(i, nchunks));
+	return result;
+    }
+
+    bool operator==(const RangeSet& other) const {
+	return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+private:
+    size_t interval_of(size_t idx) const {
+	return std::upper_bound(offsets_.begin(), offsets_.end(), idx) - offsets_.begin() - 1;
+    }
+    
+    std::vector<Interval> intervals_;
+    std::vector<size_t> offsets_;
+    size_t size_{0};
+};
+
+namespace core::lexical_cast_detail {
+
+template<class T>
+struct lexical_cast_impl<RangeSet<T>> {
+    using Interval = typename RangeSet<T>::Interval;
+    using U = std::make_unsigned_t<T>;
+    
+    RangeSet<T> convert(std::string_view s) const {
+	std::vector<Interval> intervals;
+	intervals.reserve(std::count(s.begin(), s.end(), ',') + 1);
+
+	const char *ptr = s.begin(), *end = s.end();
+	while (true) {
+	    T start{}, stop{};
+	    U step{1};
+	    ptr = parse(s, ptr, end, start);
+	    stop = start;
+	    if (ptr != end and *ptr == '-')
+		ptr = parse(s, ptr + 1, end, stop);
+	    if (ptr != end and *ptr == ':')
+		ptr = parse(s, ptr + 1, end, step);
+	    if (stop < start or step == 0)
+		throw lexical_cast_error(s, "RangeSet");
+
+	    auto distance = U(U(stop) - U(start)) / step;
+	    if (distance >= std::numeric_limits<size_t>::max())
+		throw lexical_cast_error(s, "RangeSet");
+	    intervals.push_back({start, step, size_t(distance) + 1});
+
+	    if (ptr == end)
+		break;
+	    if (*ptr != ',')
+		throw lexical_cast_error(s, "RangeSet");
+	    ++ptr;
+	}
+
+	try {
+	    return RangeSet<T>{std::move(intervals)};
+	} catch (std::invalid_argument const&) {
+	    throw lexical_cast_error(s, "RangeSet");
+	}
+    }
+
+    std::string to_string(const RangeSet<T>& value) const {
+	std::string r;
+	for (const auto& interval : value.intervals()) {
+	    if (not r.empty()) r += ",";
+	    r += lexical_to_string(interval.start);
+	    if (interval.count > 1) {
+		r += "-" + lexical_to_string(interval.last());
+		if (interval.step != 1)
+		    r += ":" + lexical_to_string(interval.step);
+	    }
+	}
+	return r;
+    }
+
+private:
+    template<class V>
+    static const char *parse(std::string_view s, const char *begin, const char *end, V& value) {
+	auto r = std::from_chars(begin, end, value);
+	if (r.ec != std::errc{})
+	    throw lexical_cast_error(s, "RangeSet");
+	return r.ptr;
+    }
+};
+
+};
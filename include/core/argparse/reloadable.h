@@ -0,0 +1,195 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core::argp
+{
+
+/// Install a handler that records a reload request whenever `signo` is delivered.
+void install_reload_signal(int signo = SIGHUP);
+
+/// Consume a pending reload request, returning true at most once per request.
+bool take_reload_request();
+
+/// A sequence of parsed generations of a set of options that can be reparsed while
+/// other threads read them.
+///
+/// Each generation is a fully parsed and validated ArgParse object that is never
+/// modified after it is published. A reload parses the next generation off to the
+/// side and publishes it with a single atomic pointer exchange. Readers announce
+/// the epoch they entered in a private slot, so taking a snapshot is wait-free and
+/// a retired generation is reclaimed once no slot still refers to an older epoch.
+///
+/// \note Options bound to a caller-owned struct are shared by all generations and
+/// must not be used with Reloadable.
+/// \tparam Factory Callable returning a freshly constructed ArgParse object.
+template<class Factory>
+class Reloadable
+{
+public:
+    using Parser = std::invoke_result_t<Factory&>;
+    static constexpr size_t MaxReaders = 64;
+    
+private:
+    static constexpr uint64_t Idle = std::numeric_limits<uint64_t>::max();
+
+    struct alignas(64) Slot
+    {
+	std::atomic<uint64_t> epoch{Idle};
+	std::atomic<bool> claimed{false};
+    };
+    
+public:
+    /// A consistent view of one generation, valid until destroyed.
+    class Snapshot
+    {
+    public:
+	Snapshot(Slot *slot, const Parser *parser)
+	    : m_slot(slot)
+	    , m_parser(parser)
+	{ }
+
+	Snapshot(const Snapshot&) = delete;
+	Snapshot& operator=(const Snapshot&) = delete;
+	
+	~Snapshot()
+	{ m_slot->epoch.store(Idle, std::memory_order_release); }
+
+	const Parser& operator*() const { return *m_parser; }
+	const Parser *operator->() const { return m_parser; }
+	
+    private:
+	Slot *m_slot;
+	const Parser *m_parser;
+    };
+
+    /// A handle through which one thread takes snapshots, one at a time.
+    class Reader
+    {
+    public:
+	Reader(Reloadable *owner, Slot *slot)
+	    : m_owner(owner)
+	    , m_slot(slot)
+	{ }
+
+	Reader(Reader&& other)
+	    : m_owner(other.m_owner)
+	    , m_slot(std::exchange(other.m_slot, nullptr))
+	{ }
+
+	Reader(const Reader&) = delete;
+	Reader& operator=(const Reader&) = delete;
+	
+	~Reader()
+	{
+	    if (m_slot)
+		m_slot->claimed.store(false, std::memory_order_release);
+	}
+
+	Snapshot snapshot()
+	{
+	    m_slot->epoch.store(m_owner->m_epoch.load());
+	    return Snapshot{m_slot, m_owner->m_current.load()};
+	}
+
+    private:
+	Reloadable *m_owner;
+	Slot *m_slot;
+    };
+
+    /// Construct the first generation by parsing `args`.
+    ///
+    /// \param factory Callable returning a freshly constructed ArgParse object.
+    /// \param args The arguments for the first generation.
+    Reloadable(Factory factory, const std::vector<std::string>& args)
+	: m_factory(std::move(factory))
+    { m_current.store(make_generation(args).release()); }
+
+    Reloadable(const Reloadable&) = delete;
+    Reloadable& operator=(const Reloadable&) = delete;
+    
+    ~Reloadable()
+    { delete m_current.load(); }
+
+    /// Claim a reader slot for the calling thread.
+    ///
+    /// \throws std::runtime_error if all MaxReaders slots are claimed.
+    Reader reader()
+    {
+	for (auto& slot : m_slots)
+	    if (not slot.claimed.exchange(true, std::memory_order_acquire))
+		return Reader{this, &slot};
+	throw std::runtime_error("Reloadable: no free reader slot");
+    }
+
+    /// Parse `args` into a new generation and publish it.
+    ///
+    /// If parsing throws the current generation remains published.
+    /// \param args The arguments for the new generation.
+    void reload(const std::vector<std::string>& args)
+    {
+	auto next = make_generation(args);
+	
+	std::lock_guard lock(m_mutex);
+	std::unique_ptr<const Parser> previous{m_current.exchange(next.release())};
+	auto epoch = m_epoch.fetch_add(1) + 1;
+	m_retired.emplace_back(epoch, std::move(previous));
+	reclaim();
+    }
+
+    /// Reload from `args` if a reload signal was received since the last poll.
+    ///
+    /// \returns True if a new generation was published.
+    bool poll(const std::vector<std::string>& args)
+    {
+	if (not take_reload_request())
+	    return false;
+	reload(args);
+	return true;
+    }
+
+    /// The number of retired generations still awaiting reclamation.
+    size_t retired() const
+    {
+	std::lock_guard lock(m_mutex);
+	return m_retired.size();
+    }
+    
+private:
+    std::unique_ptr<const Parser> make_generation(const std::vector<std::string>& args)
+    {
+	auto parser = std::make_unique<Parser>(m_factory());
+	parser->parse(args);
+	return parser;
+    }
+
+    void reclaim()
+    {
+	auto oldest = Idle;
+	for (const auto& slot : m_slots)
+	    oldest = std::min(oldest, slot.epoch.load());
+	std::erase_if(m_retired, [&](const auto& entry) { return entry.first <= oldest; });
+    }
+    
+    Factory m_factory;
+    std::atomic<const Parser*> m_current{nullptr};
+    std::atomic<uint64_t> m_epoch{1};
+    std::array<Slot, MaxReaders> m_slots;
+    mutable std::mutex m_mutex;
+    std::vector<std::pair<uint64_t, std::unique_ptr<const Parser>>> m_retired;
+};
+
+}; // core::argp
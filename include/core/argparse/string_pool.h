@@ -0,0 +1,299 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "core/argparse/detail/cache.h"
+#include "core/argparse/detail/container.h"
+
+/// Strings stored back to back in one buffer and exposed as string_views.
+///
+/// As the container of an argValues option, each value costs its
+/// characters plus one offset instead of a separate allocation. The
+/// views returned remain valid only until the pool is next modified.
+class StringPool {
+public:
+    using value_type = std::string_view;
+    using size_type = size_t;
+    
+    class iterator {
+    public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = std::string_view;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = std::string_view;
+
+	iterator() = default;
+
+	iterator(const StringPool *pool, size_t idx)
+	    : pool_(pool)
+	    , idx_(idx) {
+	}
+
+	std::string_view operator*() const {
+	    return (*pool_)[idx_];
+	}
+
+	std::string_view operator[](difference_type n) const {
+	    return (*pool_)[idx_ + n];
+	}
+
+	iterator& operator++() { ++idx_; return *this; }
+	iterator operator++(int) { auto r = *this; ++idx_; return r; }
+	iterator& operator--() { --idx_; return *this; }
+	iterator operator--(int) { auto r = *this; --idx_; return r; }
+	iterator& operator+=(difference_type n) { idx_ += n; return *this; }
+	iterator& operator-=(difference_type n) { idx_ -= n; return *this; }
+	iterator operator+(difference_type n) const { return iterator{pool_, idx_ + n}; }
+	iterator operator-(difference_type n) const { return iterator{pool_, idx_ - n}; }
+	friend iterator operator+(difference_type n, const iterator& i) { return i + n; }
+	difference_type operator-(const iterator& other) const { return idx_ - other.idx_; }
+	auto operator<=>(const iterator& other) const { return idx_ <=> other.idx_; }
+	bool operator==(const iterator& other) const { return idx_ == other.idx_; }
+
+    private:
+	const StringPool *pool_{nullptr};
+	size_t idx_{0};
+    };
+
+    StringPool() = default;
+    
+    size_t size() const {
+	return offsets_.size() - 1;
+    }
+
+    bool empty() const {
+	return size() == 0;
+    }
+
+    std::string_view operator[](size_t idx) const {
+	return std::string_view(data_).substr(offsets_[idx], offsets_[idx + 1] - offsets_[idx]);
+    }
+
+    iterator begin() const {
+	return iterator{this, 0};
+    }
+
+    iterator end() const {
+	return iterator{this, size()};
+    }
+
+    /// Reserve space for `count` strings; the characters grow geometrically.
+    void reserve(size_t count) {
+	offsets_.reserve(count + 1);
+    }
+
+    void emplace_back(std::string_view str) {
+	data_.append(str);
+	offsets_.push_back(data_.size());
+    }
+
+    void push_back(std::string_view str) {
+	emplace_back(str);
+    }
+
+    void clear() {
+	data_.clear();
+	offsets_.assign(1, 0);
+    }
+
+    /// All of the characters, back to back.
+    std::string_view chars() const {
+	return data_;
+    }
+
+    /// The heap memory in use, excluding unused capacity.
+    size_t bytes() const {
+	return data_.size() + offsets_.size() * sizeof(size_t);
+    }
+
+    bool operator==(const StringPool& other) const {
+	return offsets_ == other.offsets_ and data_ == other.data_;
+    }
+
+private:
+    std::string data_;
+    std::vector<size_t> offsets_{0};
+};
+
+/// A StringPool that stores each distinct string once.
+///
+/// Each value costs a 32-bit id; repeated values, as when many
+/// positionals name the same few files, share their characters. A
+/// linear probing hash index over the ids finds existing strings.
+class StringTable {
+public:
+    using value_type = std::string_view;
+    using size_type = size_t;
+
+    class iterator {
+    public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = std::string_view;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = std::string_view;
+
+	iterator() = default;
+
+	iterator(const StringTable *table, size_t idx)
+	    : table_(table)
+	    , idx_(idx) {
+	}
+
+	std::string_view operator*() const {
+	    return (*table_)[idx_];
+	}
+
+	std::string_view operator[](difference_type n) const {
+	    return (*table_)[idx_ + n];
+	}
+
+	iterator& operator++() { ++idx_; return *this; }
+	iterator operator++(int) { auto r = *this; ++idx_; return r; }
+	iterator& operator--() { --idx_; return *this; }
+	iterator operator--(int) { auto r = *this; --idx_; return r; }
+	iterator& operator+=(difference_type n) { idx_ += n; return *this; }
+	iterator& operator-=(difference_type n) { idx_ -= n; return *this; }
+	iterator operator+(difference_type n) const { return iterator{table_, idx_ + n}; }
+	iterator operator-(difference_type n) const { return iterator{table_, idx_ - n}; }
+	friend iterator operator+(difference_type n, const iterator& i) { return i + n; }
+	difference_type operator-(const iterator& other) const { return idx_ - other.idx_; }
+	auto operator<=>(const iterator& other) const { return idx_ <=> other.idx_; }
+	bool operator==(const iterator& other) const { return idx_ == other.idx_; }
+
+    private:
+	const StringTable *table_{nullptr};
+	size_t idx_{0};
+    };
+
+    StringTable() = default;
+
+    size_t size() const {
+	return ids_.size();
+    }
+
+    bool empty() const {
+	return ids_.empty();
+    }
+
+    std::string_view operator[](size_t idx) const {
+	return unique_[ids_[idx]];
+    }
+
+    /// The id of the `idx`th value; equal values have equal ids.
+    uint32_t id(size_t idx) const {
+	return ids_[idx];
+    }
+
+    iterator begin() const {
+	return iterator{this, 0};
+    }
+
+    iterator end() const {
+	return iterator{this, size()};
+    }
+
+    void reserve(size_t count) {
+	ids_.reserve(count);
+    }
+
+    /// Add `str`, throwing std::length_error beyond 2^32 - 1 distinct strings.
+    void emplace_back(std::string_view str);
+
+    void push_back(std::string_view str) {
+	emplace_back(str);
+    }
+
+    void clear();
+
+    /// The distinct strings in order of first appearance.
+    const StringPool& unique() const {
+	return unique_;
+    }
+
+    /// The heap memory in use, excluding unused capacity.
+    size_t bytes() const {
+	return unique_.bytes() + ids_.size() * sizeof(uint32_t) + slots_.size() * sizeof(uint32_t);
+    }
+
+    bool operator==(const StringTable& other) const {
+	return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+private:
+    static constexpr uint32_t Empty = std::numeric_limits<uint32_t>::max();
+    
+    void rehash(size_t nslots);
+    
+    StringPool unique_;
+    std::vector<uint32_t> ids_;
+    std::vector<uint32_t> slots_;
+};
+
+namespace core::argp {
+
+// The values are views of the tokens, which the pool copies.
+template<>
+struct container_traits<StringPool> {
+    using element_type = std::string_view;
+    static constexpr size_t Min = 1;
+    static constexpr size_t Max = std::numeric_limits<size_t>::max();
+
+    static std::string_view convert(std::string_view input) {
+	return input;
+    }
+};
+
+template<>
+struct container_traits<StringTable> : container_traits<StringPool> {
+};
+
+template<class C>
+requires std::same_as<C, StringPool> or std::same_as<C, StringTable>
+struct string_pool_cache_traits {
+    static void save(CacheWriter& w, const C& value) {
+	uint64_t size = value.size();
+	w.write(&size, sizeof(size));
+	for (auto str : value) {
+	    uint64_t length = str.size();
+	    w.write(&length, sizeof(length));
+	    w.write(str.data(), str.size());
+	}
+    }
+
+    // Each string takes at least its length, and its characters are
+    // checked against the payload by read_view before the pool copies
+    // them straight from the mapped file.
+    static bool load(CacheReader& r, C& value) {
+	uint64_t size{};
+	if (not r.read(&size, sizeof(size)) or size > r.remaining() / sizeof(uint64_t))
+	    return false;
+	value.clear();
+	value.reserve(size);
+	for (uint64_t i = 0; i < size; ++i) {
+	    uint64_t length{};
+	    std::string_view str;
+	    if (not r.read(&length, sizeof(length)) or not r.read_view(str, length))
+		return false;
+	    value.emplace_back(str);
+	}
+	return true;
+    }
+};
+
+template<>
+struct cache_traits<StringPool> : string_pool_cache_traits<StringPool> {
+};
+
+template<>
+struct cache_traits<StringTable> : string_pool_cache_traits<StringTable> {
+};
+
+}; // core::argp
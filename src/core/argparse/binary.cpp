@@ -0,0 +1,185 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include "core/argparse/binary.h"
+
+namespace {
+
+constexpr uint64_t repeat(uint8_t byte)
+{
+    return 0x0101010101010101 * byte;
+}
+
+// Each byte of the result has its high bit set where the corresponding
+// byte of `x`, which must be below 0x80, lies in [lo, hi].
+constexpr uint64_t in_range(uint64_t x, uint8_t lo, uint8_t hi)
+{
+    return (x + repeat(0x80 - lo)) & ~(x + repeat(0x7f - hi)) & repeat(0x80);
+}
+
+// Decode eight hex digits into four bytes, eight lanes at a time within
+// a 64-bit word. Returns false if any of them is not a hex digit.
+bool decode_hex8(const char *in, std::byte *out)
+{
+    uint64_t x;
+    std::memcpy(&x, in, sizeof(x));
+    if (x & repeat(0x80))
+	return false;
+
+    auto digit = in_range(x, '0', '9');
+    auto letter = in_range(x | repeat(0x20), 'a', 'f');
+    if ((digit | letter) != repeat(0x80))
+	return false;
+
+    // 'a' and 'A' have low nibble 1, so letters are offset by nine.
+    auto nibbles = (x & repeat(0x0f)) + (letter >> 7) * 9;
+    auto pairs = ((nibbles & 0x00ff00ff00ff00ff) << 4) | ((nibbles >> 8) & 0x00ff00ff00ff00ff);
+    pairs = (pairs | (pairs >> 8)) & 0x0000ffff0000ffff;
+    auto bytes = static_cast<uint32_t>(pairs | (pairs >> 16));
+    std::memcpy(out, &bytes, sizeof(bytes));
+    return true;
+}
+
+constexpr uint8_t Invalid = 0xff;
+
+constexpr std::array<uint8_t, 256> HexValues = []() {
+    std::array<uint8_t, 256> table;
+    table.fill(Invalid);
+    for (int c = 0; c < 10; ++c)
+	table['0' + c] = c;
+    for (int c = 0; c < 6; ++c)
+	table['a' + c] = table['A' + c] = 10 + c;
+    return table;
+}();
+
+constexpr char HexDigits[] = "0123456789abcdef";
+
+constexpr char Base64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// The six bits of each base64 character, shifted into place for each of
+// the four positions of a quad so that a quad decodes with three ORs.
+// Bit 31 marks an invalid character, so errors accumulate in the same
+// ORs and are checked once at the end.
+constexpr uint32_t Base64Invalid = 0x80000000;
+
+constexpr std::array<std::array<uint32_t, 256>, 4> Base64Values = []() {
+    std::array<std::array<uint32_t, 256>, 4> tables;
+    for (auto& table : tables)
+	table.fill(Base64Invalid);
+    for (uint32_t value = 0; value < 64; ++value)
+    {
+	auto c = static_cast<unsigned char>(Base64Digits[value]);
+	for (int pos = 0; pos < 4; ++pos)
+	    tables[pos][c] = value << (18 - 6 * pos);
+    }
+    return tables;
+}();
+
+// The number of padding characters ending `s`.
+size_t base64_padding(std::string_view s)
+{
+    if (s.size() % 4 != 0) return 0;
+    else if (s.ends_with("==")) return 2;
+    else if (s.ends_with('=')) return 1;
+    return 0;
+}
+
+void put3(uint32_t bits, std::byte *out)
+{
+    out[0] = std::byte(bits >> 16);
+    out[1] = std::byte(bits >> 8);
+    out[2] = std::byte(bits);
+}
+
+}; // anonymous
+
+namespace core::lexical_cast_detail {
+
+bool decode_hex(std::string_view s, std::byte *out)
+{
+    const char *ptr = s.data(), *end = s.data() + s.size();
+    if constexpr (std::endian::native == std::endian::little)
+	for (; end - ptr >= 8; ptr += 8, out += 4)
+	    if (not decode_hex8(ptr, out))
+		return false;
+
+    for (; ptr < end; ptr += 2)
+    {
+	auto hi = HexValues[static_cast<unsigned char>(ptr[0])];
+	auto lo = HexValues[static_cast<unsigned char>(ptr[1])];
+	if (hi == Invalid or lo == Invalid)
+	    return false;
+	*out++ = std::byte((hi << 4) | lo);
+    }
+    return true;
+}
+
+std::string encode_hex(std::span<const std::byte> bytes)
+{
+    std::string r(2 * bytes.size(), '\0');
+    for (size_t i = 0; i < bytes.size(); ++i)
+    {
+	auto b = std::to_integer<unsigned>(bytes[i]);
+	r[2 * i] = HexDigits[b >> 4];
+	r[2 * i + 1] = HexDigits[b & 0xf];
+    }
+    return r;
+}
+
+std::optional<size_t> base64_size(std::string_view s)
+{
+    auto chars = s.size() - base64_padding(s);
+    if (chars % 4 == 1)
+	return std::nullopt;
+    return chars / 4 * 3 + (chars % 4 == 0 ? 0 : chars % 4 - 1);
+}
+
+bool decode_base64(std::string_view s, std::byte *out)
+{
+    auto chars = s.size() - base64_padding(s);
+    auto in = reinterpret_cast<const unsigned char*>(s.data());
+    const auto& [t0, t1, t2, t3] = Base64Values;
+    uint32_t errors{0};
+    size_t idx{0};
+    for (; idx + 4 <= chars; idx += 4, out += 3)
+    {
+	auto bits = t0[in[idx]] | t1[in[idx + 1]] | t2[in[idx + 2]] | t3[in[idx + 3]];
+	errors |= bits;
+	put3(bits, out);
+    }
+
+    // The final two or three characters carry one or two bytes and the
+    // bits after them must be zero.
+    if (auto rest = chars - idx; rest > 0)
+    {
+	auto bits = t0[in[idx]] | t1[in[idx + 1]] | (rest == 3 ? t2[in[idx + 2]] : 0);
+	errors |= bits;
+	if (bits & (rest == 3 ? 0xff : 0xffff))
+	    return false;
+	out[0] = std::byte(bits >> 16);
+	if (rest == 3)
+	    out[1] = std::byte(bits >> 8);
+    }
+    return (errors & Base64Invalid) == 0;
+}
+
+std::string encode_base64(std::span<const std::byte> bytes)
+{
+    std::string r;
+    r.reserve((bytes.size() + 2) / 3 * 4);
+    auto byte = [&](size_t idx) { return idx < bytes.size() ? std::to_integer<uint32_t>(bytes[idx]) : 0; };
+    for (size_t idx = 0; idx < bytes.size(); idx += 3)
+    {
+	auto bits = (byte(idx) << 16) | (byte(idx + 1) << 8) | byte(idx + 2);
+	auto count = std::min<size_t>(bytes.size() - idx, 3);
+	for (size_t pos = 0; pos < 4; ++pos)
+	    r += pos <= count ? Base64Digits[(bits >> (18 - 6 * pos)) & 0x3f] : '=';
+    }
+    return r;
+}
+
+}; // core::lexical_cast_detail
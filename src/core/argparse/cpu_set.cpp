@@ -0,0 +1,115 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <cerrno>
+#include <fstream>
+#include <system_error>
+#include <pthread.h>
+#include "core/argparse/cpu_set.h"
+
+namespace {
+
+// The first line of a sysfs list file, or nothing if it cannot be read.
+std::string read_list(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+cpu_set_t single(size_t cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return set;
+}
+
+}; // anonymous
+
+CpuSet CpuSet::available()
+{
+    cpu_set_t set;
+    if (::sched_getaffinity(0, sizeof(set), &set) < 0)
+	throw std::system_error(errno, std::generic_category(), "sched_getaffinity");
+
+    CpuSet r;
+    for (size_t cpu = 0; cpu < Capacity; ++cpu)
+	if (CPU_ISSET(cpu, &set))
+	    r.insert(cpu);
+    return r;
+}
+
+cpu_set_t CpuSet::native() const
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : *this)
+	CPU_SET(cpu, &set);
+    return set;
+}
+
+void CpuSet::pin() const
+{
+    auto set = native();
+    if (::sched_setaffinity(0, sizeof(set), &set) < 0)
+	throw std::system_error(errno, std::generic_category(), "sched_setaffinity");
+}
+
+void CpuSet::pin(size_t idx) const
+{
+    if (empty())
+	throw std::system_error(EINVAL, std::generic_category(), "CpuSet::pin: empty set");
+    
+    auto set = single((*this)[idx % size()]);
+    if (::sched_setaffinity(0, sizeof(set), &set) < 0)
+	throw std::system_error(errno, std::generic_category(), "sched_setaffinity");
+}
+
+void CpuSet::spread(std::span<std::thread> threads) const
+{
+    if (empty())
+	throw std::system_error(EINVAL, std::generic_category(), "CpuSet::spread: empty set");
+
+    auto iter = begin();
+    for (auto& thread : threads)
+    {
+	if (iter == end())
+	    iter = begin();
+	auto set = single(*iter++);
+	if (int code = ::pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set))
+	    throw std::system_error(code, std::generic_category(), "pthread_setaffinity_np");
+    }
+}
+
+NumaSet NumaSet::online()
+{
+    auto list = read_list("/sys/devices/system/node/online");
+    if (list.empty())
+	return NumaSet{0};
+    return core::lexical_cast_detail::parse_id_set<NumaSet>(list, "NumaSet");
+}
+
+CpuSet NumaSet::cpus() const
+{
+    auto available = CpuSet::available();
+    core::argp::IdSet<CpuSet::Capacity> r;
+    for (auto node : *this)
+    {
+	auto path = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+	auto list = read_list(path);
+	if (list.empty())
+	{
+	    // Without NUMA support there is no node directory; node 0 has every CPU.
+	    if (node == 0 and online() == NumaSet{0})
+		return available;
+	    continue;
+	}
+
+	auto cpus = core::lexical_cast_detail::parse_id_set<CpuSet>(list, "CpuSet");
+	for (auto cpu : cpus)
+	    r.insert(cpu);
+    }
+    return CpuSet{r};
+}
@@ -43,8 +43,7 @@ bool is_option_group(std::string_view arg)
 {
     return arg.size() > 2
 	and arg[0] == OptionSymbol
-	and is_identifier(arg[1])
-	and is_identifier(arg[2]);
+	and is_identifier(arg[1]);
 }
 
 std::string make_spec(std::string_view arg_value, size_t min, size_t max)
@@ -0,0 +1,161 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "core/argparse/detail/cache.h"
+#include "core/argparse/mapped_array.h"
+
+namespace core::argp
+{
+
+namespace {
+
+constexpr char Magic[8] = { 'A', 'R', 'G', 'P', 'C', 'A', 'C', 'H' };
+constexpr uint32_t Version = 1;
+
+struct CacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t key;
+    uint64_t size;
+    uint64_t checksum;
+};
+
+// FNV-1a, which is plenty for detecting a changed command line.
+class Hash
+{
+public:
+    void add(const void *data, size_t size)
+    {
+	auto bytes = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < size; ++i)
+	    m_value = (m_value ^ bytes[i]) * 0x100000001b3ull;
+    }
+
+    void add(std::string_view str)
+    {
+	uint64_t size = str.size();
+	add(&size, sizeof(size));
+	add(str.data(), str.size());
+    }
+
+    uint64_t value() const
+    { return m_value; }
+
+private:
+    uint64_t m_value{0xcbf29ce484222325ull};
+};
+
+bool write_all(int fd, const void *data, size_t size)
+{
+    auto ptr = static_cast<const char*>(data);
+    while (size > 0)
+    {
+	auto n = ::write(fd, ptr, size);
+	if (n < 0)
+	    return false;
+	ptr += n;
+	size -= n;
+    }
+    return true;
+}
+
+}; // anonymous
+
+uint64_t cache_key(std::span<const std::string> args,
+		   std::span<const std::string> dependencies,
+		   std::string_view signature)
+{
+    Hash hash;
+    hash.add(&Version, sizeof(Version));
+    hash.add(signature);
+    
+    uint64_t count = args.size();
+    hash.add(&count, sizeof(count));
+    for (const auto& arg : args)
+	hash.add(arg);
+
+    for (const auto& path : dependencies)
+    {
+	hash.add(path);
+	struct stat st;
+	int64_t stamp[3] = { -1, -1, -1 };
+	if (::stat(path.c_str(), &st) == 0)
+	{
+	    stamp[0] = st.st_mtim.tv_sec;
+	    stamp[1] = st.st_mtim.tv_nsec;
+	    stamp[2] = st.st_size;
+	}
+	hash.add(stamp, sizeof(stamp));
+    }
+    return hash.value();
+}
+
+bool CacheWriter::commit(const std::string& path, uint64_t key) const
+{
+    CacheHeader header{};
+    std::copy(std::begin(Magic), std::end(Magic), header.magic);
+    header.version = Version;
+    header.key = key;
+    header.size = m_buffer.size();
+    Hash checksum;
+    checksum.add(m_buffer.data(), m_buffer.size());
+    header.checksum = checksum.value();
+
+    // Write a temporary file and rename it over the cache so that readers
+    // never observe a partial cache. mkostemp creates the file exclusively
+    // under an unpredictable name, so a link planted in a shared directory
+    // cannot redirect the write.
+    auto tmp = path + ".tmp.XXXXXX";
+    int fd = ::mkostemp(tmp.data(), O_CLOEXEC);
+    if (fd < 0)
+	return false;
+    ::fchmod(fd, 0644);
+
+    bool ok = write_all(fd, &header, sizeof(header))
+	and write_all(fd, m_buffer.data(), m_buffer.size());
+    ok = (::close(fd) == 0) and ok;
+    if (ok and std::rename(tmp.c_str(), path.c_str()) == 0)
+	return true;
+    
+    ::unlink(tmp.c_str());
+    return false;
+}
+
+CacheReader::CacheReader() = default;
+
+CacheReader::~CacheReader() = default;
+
+bool CacheReader::open(const std::string& path, uint64_t key)
+{
+    try { m_file = std::make_unique<MappedFile>(path); }
+    catch (const std::system_error&) { return false; }
+
+    if (m_file->size() < sizeof(CacheHeader))
+	return false;
+
+    CacheHeader header;
+    std::memcpy(&header, m_file->data(), sizeof(header));
+    if (not std::equal(std::begin(Magic), std::end(Magic), header.magic)
+	or header.version != Version
+	or header.key != key
+	or header.size != m_file->size() - sizeof(CacheHeader))
+	return false;
+
+    auto payload = std::span{m_file->data() + sizeof(CacheHeader), header.size};
+    Hash checksum;
+    checksum.add(payload.data(), payload.size());
+    if (checksum.value() != header.checksum)
+	return false;
+    
+    m_payload = payload;
+    return true;
+}
+
+}; // core::argp
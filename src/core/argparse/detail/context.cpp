@@ -2,15 +2,52 @@
 //
 
 #include "core/argparse/detail/context.h"
+#include "core/argparse/detail/error.h"
 
 namespace core::argp
 {
 
-Context::Context(const std::vector<std::string>& args)
+// The tokens up to and including `end`, positioned at `end`, so that an
+// error raised before the tokens are copied costs no more than the limit.
+static Context prefix(const std::vector<std::string>& args, size_t end)
+{
+    Context ctx(std::vector<std::string>(args.begin(), args.begin() + end + 1));
+    for (size_t idx = 0; idx < end; ++idx)
+	ctx.pop();
+    return ctx;
+}
+
+Context::Context(const std::vector<std::string>& args, const Limits& limits, const FlagTable *flags)
     : m_index(0)
+    , m_limits(limits)
+    , m_flags(flags)
+{
+    auto ntokens = args.empty() ? 0 : args.size() - 1;
+    if (ntokens > limits.max_tokens)
+	throw token_limit_error(prefix(args, limits.max_tokens + 1), ntokens, limits.max_tokens);
+    
+    if (limits.max_bytes != Limits::Unlimited)
+    {
+	size_t bytes{0};
+	for (size_t idx = 1; idx < args.size(); ++idx)
+	    if ((bytes += args[idx].size()) > limits.max_bytes)
+		throw byte_limit_error(prefix(args, idx), bytes, limits.max_bytes);
+    }
+    
+    m_tokens.assign(args.begin(), args.end());
+}
+
+void Context::assign(std::string_view token)
 {
-    for (const auto& arg : args)
-	m_tokens.push_back(arg);
+    m_tokens.resize(1);
+    m_tokens[0].assign(token);
+    m_index = 0;
+
+    if (++m_assigned > m_limits.max_tokens)
+	throw token_limit_error(*this, m_assigned, m_limits.max_tokens);
+    if ((m_assigned_bytes += token.size()) > m_limits.max_bytes)
+	throw byte_limit_error(*this, m_assigned_bytes, m_limits.max_bytes);
+    tick();
 }
 
 bool Context::end() const
@@ -27,6 +64,28 @@ void Context::pop()
 {
     if (m_index < m_tokens.size())
 	++m_index;
+    tick();
+}
+
+bool Context::ends_values(std::string_view token) const
+{
+    return is_option(token)
+	or is_option_separator(token)
+	or (m_flags and is_option_group(token)
+	    and (*m_flags)[static_cast<unsigned char>(token[1])] >= 0);
+}
+
+size_t Context::count_values() const
+{
+    size_t idx = m_index;
+    while (idx < m_tokens.size() and not ends_values(m_tokens[idx]))
+	++idx;
+    return idx - m_index;
+}
+
+std::span<const std::string> Context::peek(size_t count) const
+{
+    return std::span{m_tokens}.subspan(m_index, count);
 }
 
 const std::vector<std::string>& Context::tokens() const
@@ -34,6 +93,20 @@ const std::vector<std::string>& Context::tokens() const
     return m_tokens;
 }
 
+const Limits& Context::limits() const
+{
+    return m_limits;
+}
+
+// Reading the clock for every token would dominate the cost of short
+// tokens, so the deadline is checked at every Interval-th one.
+void Context::tick()
+{
+    static constexpr size_t Interval = 64;
+    if (m_limits.deadline and m_ticks++ % Interval == 0 and Limits::Clock::now() > *m_limits.deadline)
+	throw deadline_error(*this);
+}
+
 std::string Context::canonical_line() const
 {
     std::string line;
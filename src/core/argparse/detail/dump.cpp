@@ -0,0 +1,57 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include "core/argparse/detail/dump.h"
+
+namespace core::argp
+{
+
+std::string_view origin_name(Origin origin)
+{
+    switch (origin)
+    {
+    case Origin::Default: return "default";
+    case Origin::CommandLine: return "command-line";
+    case Origin::Cache: return "cache";
+    }
+    return "unknown";
+}
+
+void DumpWriter::string(std::string_view text, DumpFormat format)
+{
+    if (format == DumpFormat::KeyValue
+	and not text.empty()
+	and text.find_first_of(" \"\\,=:\n") == std::string_view::npos)
+    {
+	put(text);
+	return;
+    }
+
+    static constexpr char Hex[] = "0123456789abcdef";
+    put('"');
+    size_t start{0};
+    for (size_t idx = 0; idx < text.size(); ++idx)
+    {
+	auto c = static_cast<unsigned char>(text[idx]);
+	if (c >= 0x20 and c != '"' and c != '\\')
+	    continue;
+
+	put(text.substr(start, idx - start));
+	start = idx + 1;
+	switch (c)
+	{
+	case '"': put("\\\""); break;
+	case '\\': put("\\\\"); break;
+	case '\n': put("\\n"); break;
+	case '\t': put("\\t"); break;
+	default:
+	    put("\\u00");
+	    put(Hex[c >> 4]);
+	    put(Hex[c & 0xf]);
+	}
+    }
+    put(text.substr(start));
+    put('"');
+}
+
+}; // core::argp
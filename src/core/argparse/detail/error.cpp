@@ -4,6 +4,7 @@
 #include <fmt/format.h>
 #include "core/argparse/detail/error.h"
 #include "core/argparse/detail/message.h"
+#include "core/argparse/detail/suggest.h"
 #include "core/mp/type_name.h"
 
 namespace core::argp
@@ -29,8 +30,27 @@ error_count::error_count(std::string_view msg,
     , number_limit(arg_number_limit)
 { }
 
-unknown_option_error::unknown_option_error(std::string_view name, const Context& ctx)
-    : error(fmt::format(unknown_option_msg, name), ctx)
+static std::string unknown_option_message(std::string_view name,
+					  const std::vector<std::string>& suggestions)
+{
+    auto msg = fmt::format(unknown_option_msg, name);
+    if (suggestions.empty())
+	return msg;
+    
+    std::string names;
+    for (size_t i = 0; i < suggestions.size(); ++i)
+    {
+	if (i > 0) names += i + 1 == suggestions.size() ? " or " : ", ";
+	names += fmt::format("'--{}'", suggestions[i]);
+    }
+    return msg + fmt::format(suggestion_msg, names);
+}
+
+unknown_option_error::unknown_option_error(std::string_view name,
+					   const Context& ctx,
+					   std::vector<std::string> arg_suggestions)
+    : error(unknown_option_message(name, arg_suggestions), ctx)
+    , suggestions(std::move(arg_suggestions))
 { }
 
 missing_value_error::missing_value_error(std::string_view name,
@@ -39,10 +59,23 @@ missing_value_error::missing_value_error(std::string_view name,
     : error_type(fmt::format(missing_value_msg, name, core::mp::demangle(type.name())), ctx, type)
 { }
 
+unexpected_value_error::unexpected_value_error(std::string_view name,
+					       std::string_view value,
+					       const Context& ctx)
+    : error(fmt::format(unexpected_value_msg, name, value), ctx)
+{ }
+
 bad_value_error::bad_value_error(std::string_view name,
 				 const Context& ctx,
 				 const std::type_info& type)
-    : error_type(fmt::format(bad_value_msg, ctx.front(), core::mp::demangle(type.name()), name),
+    : bad_value_error(name, ctx.front(), ctx, type)
+{ }
+
+bad_value_error::bad_value_error(std::string_view name,
+				 std::string_view input,
+				 const Context& ctx,
+				 const std::type_info& type)
+    : error_type(fmt::format(bad_value_msg, input, core::mp::demangle(type.name()), name),
 		 ctx, type)
 { }
 
@@ -66,4 +99,134 @@ too_many_values_error::too_many_values_error(std::string_view name,
 		  ctx, type, number_found, number_limit)
 { }
 
+limit_error::limit_error(std::string_view msg, const Context& ctx)
+    : error(msg, ctx)
+{ }
+
+limit_count_error::limit_count_error(std::string_view msg,
+				     const Context& ctx,
+				     size_t arg_number_found,
+				     size_t arg_number_limit)
+    : limit_error(msg, ctx)
+    , number_found(arg_number_found)
+    , number_limit(arg_number_limit)
+{ }
+
+token_limit_error::token_limit_error(const Context& ctx, size_t number_found, size_t number_limit)
+    : limit_count_error(fmt::format(token_limit_msg, number_found, number_limit),
+			ctx, number_found, number_limit)
+{ }
+
+byte_limit_error::byte_limit_error(const Context& ctx, size_t number_found, size_t number_limit)
+    : limit_count_error(fmt::format(byte_limit_msg, number_found, number_limit),
+			ctx, number_found, number_limit)
+{ }
+
+// The group may be arbitrarily long, so the message only quotes its start.
+static std::string group_excerpt(std::string_view group)
+{
+    static constexpr size_t Excerpt = 16;
+    if (group.size() <= Excerpt)
+	return std::string(group);
+    return std::string(group.substr(0, Excerpt)) + "...";
+}
+
+group_limit_error::group_limit_error(std::string_view group,
+				     const Context& ctx,
+				     size_t number_found,
+				     size_t number_limit)
+    : limit_count_error(fmt::format(group_limit_msg, group_excerpt(group), number_found, number_limit),
+			ctx, number_found, number_limit)
+{ }
+
+value_limit_error::value_limit_error(std::string_view name,
+				     const Context& ctx,
+				     size_t number_found,
+				     size_t number_limit)
+    : limit_count_error(fmt::format(value_limit_msg, number_found, name, number_limit),
+			ctx, number_found, number_limit)
+{ }
+
+deadline_error::deadline_error(const Context& ctx)
+    : limit_error(deadline_msg, ctx)
+{ }
+
+glob_error::glob_error(std::string_view msg, const Context& ctx)
+    : error(msg, ctx)
+{ }
+
+unbound_error::unbound_error(const std::type_info& type)
+    : std::logic_error(fmt::format(unbound_msg, core::mp::demangle(type.name())))
+{ }
+
+constraint_error::constraint_error(std::string_view msg, const Context& ctx)
+    : error(msg, ctx)
+{ }
+
+requires_error::requires_error(std::string_view name,
+			       std::string_view required,
+			       const Context& ctx)
+    : constraint_error(fmt::format(requires_msg, name, required), ctx)
+{ }
+
+conflicts_error::conflicts_error(std::string_view name,
+				 std::string_view other,
+				 const Context& ctx)
+    : constraint_error(fmt::format(conflicts_msg, name, other), ctx)
+{ }
+
+one_of_error::one_of_error(std::string_view names,
+			   size_t number_found,
+			   const Context& ctx)
+    : constraint_error(fmt::format(one_of_msg, names, number_found), ctx)
+{ }
+
+void throw_unknown_option(std::string_view token, const Context& ctx,
+			  std::span<const std::string_view> long_names)
+{
+    if (token == "-*") throw unknown_option_error(ctx.front(), ctx);
+    else if (is_long_option(token))
+	throw unknown_option_error(token, ctx, suggest(token.substr(2), long_names));
+    else throw unknown_option_error(token, ctx);
+}
+
+void throw_unknown_flag(char c, const Context& ctx)
+{
+    throw unknown_option_error(std::string{OptionSymbol, c}, ctx);
+}
+
+void throw_unexpected_value(std::string_view name, std::string_view value, const Context& ctx)
+{
+    throw unexpected_value_error(name, value, ctx);
+}
+
+void throw_missing_value(std::string_view name, const Context& ctx, const std::type_info& type)
+{
+    throw missing_value_error(name, ctx, type);
+}
+
+void throw_bad_value(std::string_view name, std::string_view input, const Context& ctx,
+		     const std::type_info& type)
+{
+    throw bad_value_error(name, input, ctx, type);
+}
+
+void throw_value_count(std::string_view name, const Context& ctx, const std::type_info& type,
+		       size_t count, size_t min, size_t max, size_t limit)
+{
+    if (count < min) throw too_few_values_error(name, ctx, type, count, min);
+    else if (count > max) throw too_many_values_error(name, ctx, type, count, max);
+    else throw value_limit_error(name, ctx, count, limit);
+}
+
+void throw_group_limit(std::string_view group, const Context& ctx, size_t limit)
+{
+    throw group_limit_error(group, ctx, group.size() - 1, limit);
+}
+
+void throw_unbound(const std::type_info& type)
+{
+    throw unbound_error(type);
+}
+
 }; // core::argp
@@ -0,0 +1,133 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <algorithm>
+#include <utility>
+#include "core/argparse/detail/executor.h"
+
+namespace core::argp
+{
+
+ThreadPool::ThreadPool(size_t nthreads)
+{
+    for (size_t i = 0; i < std::max<size_t>(nthreads, 1); ++i)
+	m_threads.emplace_back([this]() { work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+	std::lock_guard lock(m_mutex);
+	m_stop = true;
+    }
+    m_ready.notify_all();
+    for (auto& thread : m_threads)
+	thread.join();
+}
+
+void ThreadPool::post(std::function<void()> task)
+{
+    {
+	std::lock_guard lock(m_mutex);
+	m_tasks.push_back(std::move(task));
+    }
+    m_ready.notify_one();
+}
+
+void ThreadPool::work()
+{
+    while (true)
+    {
+	std::function<void()> task;
+	{
+	    std::unique_lock lock(m_mutex);
+	    m_ready.wait(lock, [this]() { return m_stop or not m_tasks.empty(); });
+	    if (m_tasks.empty())
+		return;
+	    task = std::move(m_tasks.front());
+	    m_tasks.pop_front();
+	}
+	task();
+    }
+}
+
+ThreadPool& io_pool()
+{
+    static ThreadPool pool(IoThreads);
+    return pool;
+}
+
+void Strand::post(std::function<void()> task)
+{
+    m_calls.started();
+    bool start{false};
+    {
+	std::lock_guard lock(m_mutex);
+	m_tasks.push_back(std::move(task));
+	start = not std::exchange(m_active, true);
+    }
+    if (start)
+	m_calls.m_executor([this]() { drain(); });
+}
+
+void Strand::drain()
+{
+    while (true)
+    {
+	std::function<void()> task;
+	{
+	    std::lock_guard lock(m_mutex);
+	    task = std::move(m_tasks.front());
+	    m_tasks.pop_front();
+	}
+
+	std::exception_ptr error;
+	try { task(); }
+	catch (...) { error = std::current_exception(); }
+	task = nullptr;
+
+	// Once the last task is reported finished, the owner may destroy this
+	// strand, so the strand is released before reporting.
+	bool last{false};
+	{
+	    std::lock_guard lock(m_mutex);
+	    last = m_tasks.empty();
+	    m_active = not last;
+	}
+	m_calls.finished(error);
+	if (last)
+	    return;
+    }
+}
+
+AsyncCalls::AsyncCalls(Executor executor, size_t noptions)
+    : m_executor(std::move(executor))
+{
+    for (size_t i = 0; i < noptions; ++i)
+	m_strands.emplace_back(*this);
+}
+
+void AsyncCalls::wait()
+{
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_outstanding == 0; });
+    if (auto error = std::exchange(m_error, nullptr))
+	std::rethrow_exception(error);
+}
+
+void AsyncCalls::started()
+{
+    std::lock_guard lock(m_mutex);
+    ++m_outstanding;
+}
+
+void AsyncCalls::finished(std::exception_ptr error)
+{
+    std::lock_guard lock(m_mutex);
+    if (error and not m_error)
+	m_error = error;
+    if (--m_outstanding == 0)
+	m_idle.notify_all();
+}
+
+}; // core::argp
@@ -0,0 +1,459 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#include <fmt/format.h>
+#include "core/argparse/detail/error.h"
+#include "core/argparse/detail/executor.h"
+#include "core/argparse/detail/glob.h"
+#include "core/argparse/detail/message.h"
+
+namespace core::argp
+{
+
+namespace {
+
+// The pattern components a directory is matched against, one bit each.
+using States = uint64_t;
+static constexpr size_t MaxComponents = 64;
+
+// Walkers hand their matches over in batches of this size.
+static constexpr size_t BatchSize = 256;
+
+// A pattern split into the literal directory the walk starts in and the
+// components matched below it.
+struct Pattern
+{
+    std::string root;
+    std::vector<std::string> parts;
+};
+
+Pattern split_pattern(std::string_view pattern)
+{
+    std::vector<std::string_view> components;
+    for (size_t start = 0; start <= pattern.size(); )
+    {
+	auto end = std::min(pattern.find('/', start), pattern.size());
+	if (end > start)
+	    components.push_back(pattern.substr(start, end - start));
+	start = end + 1;
+    }
+
+    Pattern r;
+    r.root = pattern.starts_with('/') ? "/" : "";
+    size_t idx{0};
+    for (; idx + 1 < components.size() and not is_glob_pattern(components[idx]); ++idx)
+	r.root += unescape_glob(components[idx]) + "/";
+    for (; idx < components.size(); ++idx)
+	r.parts.emplace_back(components[idx]);
+
+    // A trailing ** matches every file below it, like **/*.
+    if (r.parts.empty() or r.parts.back() == "**")
+	r.parts.emplace_back("*");
+    return r;
+}
+
+// Call `func` with the name and type of each entry of the directory
+// `fd` until it returns false. The directory is closed afterwards.
+template<class F>
+void for_each_entry(int fd, std::vector<char>& buffer, F&& func)
+{
+#ifdef __linux__
+    // The layout of the records returned by getdents64.
+    struct Record
+    {
+	uint64_t ino;
+	int64_t off;
+	unsigned short reclen;
+	unsigned char type;
+	char name[1];
+    };
+
+    long size;
+    bool more{true};
+    while (more and (size = ::syscall(SYS_getdents64, fd, buffer.data(), buffer.size())) > 0)
+	for (long pos = 0; more and pos < size; )
+	{
+	    auto record = reinterpret_cast<const Record*>(buffer.data() + pos);
+	    pos += record->reclen;
+	    more = func(fd, record->name, record->type);
+	}
+    ::close(fd);
+#else
+    auto dir = ::fdopendir(fd);
+    if (dir == nullptr)
+    {
+	::close(fd);
+	return;
+    }
+    while (auto entry = ::readdir(dir))
+	if (not func(fd, entry->d_name, entry->d_type))
+	    break;
+    ::closedir(dir);
+#endif
+}
+
+// Expands a pattern with walkers on io_pool, or on the calling thread
+// when there are none.
+//
+// Each walker descends depth first through its own queue of
+// directories and, once that is empty, steals the oldest directory
+// queued by another walker, which is the nearest the root and so likely
+// has the most work below it. The walk is over when no directory is
+// queued or being read, or once more than `limit` paths match.
+class Walker
+{
+public:
+    Walker(const Pattern& pattern, size_t workers, size_t limit, const Limits& limits)
+	: m_pattern(pattern)
+	, m_limit(limit)
+	, m_deadline(limits.deadline)
+	, m_queues(std::max<size_t>(workers, 1))
+	, m_inline(workers == 0)
+    {
+	for (const auto& part : pattern.parts)
+	    m_globstar.push_back(part == "**");
+    }
+
+    // The walkers refer to the walker, so wait for all of them to return.
+    ~Walker()
+    {
+	m_stop = true;
+	std::unique_lock lock(m_mutex);
+	m_ready.wait(lock, [this]() { return m_running == 0; });
+    }
+
+    Walker(const Walker&) = delete;
+    Walker& operator=(const Walker&) = delete;
+
+    // Walk the pattern, calling `deliver` on this thread with each batch
+    // of matches as the walkers publish them.
+    void run(const std::function<void(std::vector<std::string>&)>& deliver)
+    {
+	m_pending = 1;
+	m_queues[0].items.push_back(Item{m_pattern.root, closure(1)});
+	for (size_t id = 0; id < m_queues.size(); ++id)
+	{
+	    {
+		std::lock_guard lock(m_mutex);
+		++m_running;
+	    }
+	    if (m_inline)
+		work(id);
+	    else
+		try
+		{
+		    io_pool().post([this, id]() { work(id); });
+		}
+		catch (...)
+		{
+		    std::lock_guard lock(m_mutex);
+		    --m_running;
+		    throw;
+		}
+	}
+
+	while (true)
+	{
+	    std::vector<std::vector<std::string>> batches;
+	    {
+		std::unique_lock lock(m_mutex);
+		m_ready.wait(lock, [this]() { return not m_batches.empty() or m_running == 0; });
+		if (m_batches.empty())
+		    break;
+		batches.swap(m_batches);
+	    }
+	    for (auto& batch : batches)
+		deliver(batch);
+	}
+
+	if (m_error)
+	    std::rethrow_exception(m_error);
+    }
+
+    bool expired() const
+    { return m_expired; }
+
+    // True if the walk stopped because more than `limit` paths matched.
+    bool truncated() const
+    { return m_found > m_limit; }
+
+private:
+    struct Item
+    {
+	std::string dir;
+	States states;
+    };
+
+    struct alignas(64) Queue
+    {
+	std::mutex mutex;
+	std::deque<Item> items;
+    };
+
+    // Add the states reached from each ** without consuming a directory.
+    States closure(States states) const
+    {
+	for (size_t s = 0; s < m_globstar.size(); ++s)
+	    if ((states >> s & 1) and m_globstar[s])
+		states |= States{1} << (s + 1);
+	return states;
+    }
+
+    void work(size_t id)
+    {
+	std::vector<char> buffer(1 << 15);
+	std::vector<std::string> found;
+	try
+	{
+	    Item item;
+	    for (size_t idle = 0; not m_stop; )
+	    {
+		if (next(id, item))
+		{
+		    idle = 0;
+		    walk(id, item, buffer, found);
+		    if (found.size() >= BatchSize)
+			publish(found);
+		    m_pending.fetch_sub(1, std::memory_order_acq_rel);
+		}
+		else if (m_pending.load(std::memory_order_acquire) == 0)
+		    break;
+		else if (++idle < 64)
+		    std::this_thread::yield();
+		else
+		    std::this_thread::sleep_for(std::chrono::microseconds(50));
+	    }
+	    publish(found);
+	}
+	catch (...)
+	{
+	    std::lock_guard lock(m_mutex);
+	    if (not m_error)
+		m_error = std::current_exception();
+	    m_stop = true;
+	}
+
+	// Notify under the lock, since the walker may be destroyed as soon
+	// as it is released.
+	std::lock_guard lock(m_mutex);
+	--m_running;
+	m_ready.notify_all();
+    }
+
+    bool next(size_t id, Item& item)
+    {
+	{
+	    auto& own = m_queues[id];
+	    std::lock_guard lock(own.mutex);
+	    if (not own.items.empty())
+	    {
+		item = std::move(own.items.back());
+		own.items.pop_back();
+		return true;
+	    }
+	}
+
+	for (size_t k = 1; k < m_queues.size(); ++k)
+	{
+	    auto& other = m_queues[(id + k) % m_queues.size()];
+	    std::lock_guard lock(other.mutex);
+	    if (not other.items.empty())
+	    {
+		item = std::move(other.items.front());
+		other.items.pop_front();
+		return true;
+	    }
+	}
+	return false;
+    }
+
+    void push(size_t id, Item item)
+    {
+	m_pending.fetch_add(1, std::memory_order_acq_rel);
+	std::lock_guard lock(m_queues[id].mutex);
+	m_queues[id].items.push_back(std::move(item));
+    }
+
+    void publish(std::vector<std::string>& found)
+    {
+	if (found.empty())
+	    return;
+	{
+	    std::lock_guard lock(m_mutex);
+	    m_batches.push_back(std::move(found));
+	}
+	found.clear();
+	m_ready.notify_one();
+    }
+
+    // Match the entries of the directory of `item` against its states,
+    // collecting the matches and queueing the subdirectories to descend.
+    // Directories that cannot be read are skipped, as by the shell.
+    void walk(size_t id, const Item& item, std::vector<char>& buffer, std::vector<std::string>& found)
+    {
+	if (m_deadline and Limits::Clock::now() > *m_deadline)
+	{
+	    m_expired = true;
+	    m_stop = true;
+	    return;
+	}
+
+	auto fd = ::openat(AT_FDCWD, item.dir.empty() ? "." : item.dir.c_str(),
+			   O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd < 0)
+	    return;
+
+	const auto& parts = m_pattern.parts;
+	for_each_entry(fd, buffer, [&](int dirfd, const char *name, unsigned char type) {
+	    if (name[0] == '.' and (name[1] == '\0' or (name[1] == '.' and name[2] == '\0')))
+		return not m_stop;
+
+	    // Symbolic links are followed by literal and wildcard
+	    // components but not by **, which could otherwise cycle.
+	    auto is_dir = [&](bool follow) {
+		if (type == DT_DIR)
+		    return true;
+		if ((type == DT_LNK and not follow) or (type != DT_LNK and type != DT_UNKNOWN))
+		    return false;
+		struct stat st;
+		return ::fstatat(dirfd, name, &st, follow ? 0 : AT_SYMLINK_NOFOLLOW) == 0
+		    and S_ISDIR(st.st_mode);
+	    };
+
+	    States next{0};
+	    bool matched{false};
+	    for (auto states = item.states; states; states &= states - 1)
+	    {
+		auto s = static_cast<size_t>(std::countr_zero(states));
+		if (m_globstar[s])
+		{
+		    if (name[0] != '.' and is_dir(false))
+			next |= States{1} << s;
+		}
+		else if (::fnmatch(parts[s].c_str(), name, FNM_PERIOD) == 0)
+		{
+		    if (s + 1 == parts.size())
+			matched = true;
+		    else if (is_dir(true))
+			next |= States{1} << (s + 1);
+		}
+	    }
+
+	    if (matched)
+	    {
+		if (m_found.fetch_add(1, std::memory_order_relaxed) >= m_limit)
+		{
+		    m_stop = true;
+		    return false;
+		}
+		found.push_back(item.dir + name);
+	    }
+	    if (next)
+		push(id, Item{item.dir + name + "/", closure(next)});
+	    return not m_stop;
+	});
+    }
+
+    const Pattern& m_pattern;
+    std::vector<bool> m_globstar;
+    size_t m_limit;
+    std::optional<Limits::Clock::time_point> m_deadline;
+    std::vector<Queue> m_queues;
+    bool m_inline;
+    std::atomic<size_t> m_pending{0}, m_found{0};
+    std::atomic<bool> m_stop{false}, m_expired{false};
+
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::vector<std::vector<std::string>> m_batches;
+    size_t m_running{0};
+    std::exception_ptr m_error;
+};
+
+}; // anonymous
+
+std::string unescape_glob(std::string_view token)
+{
+    std::string r;
+    for (size_t idx = 0; idx < token.size(); ++idx)
+    {
+	if (token[idx] == '\\' and idx + 1 < token.size())
+	    ++idx;
+	r += token[idx];
+    }
+    return r;
+}
+
+bool is_glob_pattern(std::string_view token)
+{
+    for (size_t idx = 0; idx < token.size(); ++idx)
+	if (token[idx] == '\\')
+	    ++idx;
+	else if (token[idx] == '*' or token[idx] == '?' or token[idx] == '[')
+	    return true;
+    return false;
+}
+
+bool expand_glob(std::string_view name, std::string_view pattern, const Glob& options,
+		 const Context& ctx, size_t limit, const GlobSink& sink)
+{
+    auto split = split_pattern(pattern);
+    if (split.parts.size() > MaxComponents)
+	throw glob_error(fmt::format(glob_depth_msg, pattern, name, MaxComponents), ctx);
+
+    // A pattern matching within one directory reads only that directory,
+    // which costs less on the calling thread than handing it to the pool.
+    auto workers = split.parts.size() == 1
+	? 0 : std::min(options.threads ? options.threads : IoThreads, IoThreads);
+
+    size_t count{0};
+    std::vector<std::string> all;
+    {
+	Walker walker(split, workers, limit, ctx.limits());
+	walker.run([&](std::vector<std::string>& batch) {
+	    count += batch.size();
+	    if (options.sorted)
+		std::move(batch.begin(), batch.end(), std::back_inserter(all));
+	    else
+		sink(batch);
+	});
+	if (walker.expired())
+	    throw deadline_error(ctx);
+	if (walker.truncated())
+	    return false;
+    }
+
+    if (options.sorted)
+    {
+	std::sort(all.begin(), all.end());
+	for (size_t pos = 0; pos < all.size(); pos += BatchSize)
+	    sink(std::span{all}.subspan(pos, std::min(BatchSize, all.size() - pos)));
+    }
+
+    if (count == 0 and not options.allow_empty)
+	throw glob_error(fmt::format(no_match_msg, pattern, name), ctx);
+    return true;
+}
+
+}; // core::argp
@@ -0,0 +1,65 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <cstdlib>
+#include <iostream>
+#include "core/argparse/detail/report.h"
+
+namespace core::argp
+{
+
+void write_help(std::ostream& os, const std::vector<std::string>& args, std::span<const HelpEntry> entries)
+{
+    static constexpr size_t Indent = 4;
+    static constexpr size_t Align = 10;
+    static constexpr size_t Info = 30;
+
+    auto program_name = args.size() > 0 ? args[0] : "unknown program";
+    os << "program: " << program_name << " [options]";
+    for (const auto& entry : entries)
+	if (entry.flag == '*')
+	    os << " " << entry.value_spec;
+    os << std::endl;
+
+    for (const auto& entry : entries)
+    {
+	if (entry.flag == '*')
+	    continue;
+
+	auto len = entry.long_name.size() + entry.value_spec.size();
+	auto n = Align - len % Align;
+	if (n + len < Info)
+	    n = Info - len;
+
+	os << std::string(Indent, ' ');
+	os << "-" << entry.flag << ", ";
+	os << "--" << entry.long_name << " ";
+	os << entry.value_spec;
+	os << std::string(n, ' ');
+	os << entry.description << std::endl;
+    }
+}
+
+void exit_with_help(const std::vector<std::string>& args, std::span<const HelpEntry> entries)
+{
+    write_help(std::cout, args, entries);
+    exit(0);
+}
+
+void exit_with_error(const std::exception& err, const std::vector<std::string>& args,
+		     std::span<const HelpEntry> entries)
+{
+    std::cerr << "The following exception was caught by ArgParse:" << std::endl;
+    std::cerr << err.what() << std::endl << std::endl;
+    std::cerr << "The orignal command line:" << std::endl;
+    for (const auto& arg : args)
+	std::cerr << arg << " ";
+    std::cerr << std::endl << std::endl;
+    std::cerr << "The command help message:" << std::endl;
+    write_help(std::cerr, args, entries);
+    std::cerr << std::endl;
+    std::cerr << "Exiting program with a return code of -1" << std::endl;
+    exit(-1);
+}
+
+}; // core::argp
@@ -0,0 +1,117 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include "core/argparse/detail/suggest.h"
+
+namespace core::argp {
+
+namespace {
+
+// The match masks of a pattern of at most 64 characters, reusable across texts.
+class BitPattern
+{
+public:
+    BitPattern(std::string_view pattern)
+	: m_size(pattern.size())
+    {
+	for (size_t i = 0; i < pattern.size(); ++i)
+	    m_peq[static_cast<unsigned char>(pattern[i])] |= uint64_t{1} << i;
+    }
+
+    size_t distance(std::string_view text) const
+    {
+	if (m_size == 0)
+	    return text.size();
+	
+	uint64_t pv = ~uint64_t{0}, mv = 0;
+	uint64_t high = uint64_t{1} << (m_size - 1);
+	size_t score = m_size;
+	for (auto c : text)
+	{
+	    uint64_t eq = m_peq[static_cast<unsigned char>(c)];
+	    uint64_t xv = eq | mv;
+	    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+	    uint64_t ph = mv | ~(xh | pv);
+	    uint64_t mh = pv & xh;
+	    if (ph & high) ++score;
+	    else if (mh & high) --score;
+	    ph = (ph << 1) | 1;
+	    mh <<= 1;
+	    pv = mh | ~(xv | ph);
+	    mv = ph & xv;
+	}
+	return score;
+    }
+
+    static constexpr size_t MaxSize = 64;
+    
+private:
+    std::array<uint64_t, 256> m_peq{};
+    size_t m_size;
+};
+
+size_t edit_distance_dynamic(std::string_view a, std::string_view b)
+{
+    std::vector<size_t> row(a.size() + 1);
+    for (size_t i = 0; i <= a.size(); ++i)
+	row[i] = i;
+    for (size_t j = 1; j <= b.size(); ++j)
+    {
+	size_t diagonal = row[0];
+	row[0] = j;
+	for (size_t i = 1; i <= a.size(); ++i)
+	{
+	    size_t above = row[i];
+	    row[i] = std::min({ row[i] + 1, row[i - 1] + 1, diagonal + (a[i - 1] != b[j - 1]) });
+	    diagonal = above;
+	}
+    }
+    return row[a.size()];
+}
+
+}; // anonymous
+
+size_t edit_distance(std::string_view a, std::string_view b)
+{
+    if (a.size() > b.size())
+	std::swap(a, b);
+    if (a.size() <= BitPattern::MaxSize)
+	return BitPattern(a).distance(b);
+    return edit_distance_dynamic(a, b);
+}
+
+std::vector<std::string> suggest(std::string_view token,
+				 std::span<const std::string_view> names,
+				 size_t max_suggestions)
+{
+    std::optional<BitPattern> pattern;
+    if (token.size() <= BitPattern::MaxSize)
+	pattern.emplace(token);
+    
+    std::vector<std::pair<size_t, std::string_view>> candidates;
+    for (auto name : names)
+    {
+	size_t limit = std::max<size_t>(1, (name.size() + 2) / 3);
+	size_t gap = name.size() > token.size() ? name.size() - token.size() : token.size() - name.size();
+	if (gap > limit)
+	    continue;
+	
+	auto distance = pattern ? pattern->distance(name) : edit_distance(token, name);
+	if (distance <= limit)
+	    candidates.emplace_back(distance, name);
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+		     [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    std::vector<std::string> result;
+    for (size_t i = 0; i < candidates.size() and i < max_suggestions; ++i)
+	result.emplace_back(candidates[i].second);
+    return result;
+}
+
+}; // core::argp
@@ -0,0 +1,51 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "core/argparse/mapped_array.h"
+
+namespace core::argp
+{
+
+MappedFile::MappedFile(std::string_view path)
+    : path_(path)
+{
+    int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+	throw std::system_error(errno, std::generic_category(), path_);
+
+    struct stat st;
+    int code = ::fstat(fd, &st) < 0 ? errno : (S_ISREG(st.st_mode) ? 0 : EINVAL);
+    if (code != 0)
+    {
+	::close(fd);
+	throw std::system_error(code, std::generic_category(), path_);
+    }
+
+    size_ = st.st_size;
+    if (size_ > 0)
+    {
+	auto addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (addr == MAP_FAILED)
+	{
+	    auto code = errno;
+	    ::close(fd);
+	    throw std::system_error(code, std::generic_category(), path_);
+	}
+	data_ = static_cast<const std::byte*>(addr);
+    }
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+	::munmap(const_cast<std::byte*>(data_), size_);
+}
+
+}; // core::argp
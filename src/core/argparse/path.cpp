@@ -0,0 +1,117 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <atomic>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include "core/argparse/path.h"
+#include "core/argparse/detail/executor.h"
+
+namespace core::argp
+{
+
+FileDescriptor::~FileDescriptor()
+{
+    if (fd_ >= 0)
+	::close(fd_);
+}
+
+PathProbe probe_path(const std::string& path, unsigned checks)
+{
+    PathProbe probe;
+    auto mask = STATX_TYPE | STATX_MODE | STATX_SIZE | STATX_MTIME;
+    if (::statx(AT_FDCWD, path.c_str(), AT_STATX_SYNC_AS_STAT, mask, &probe.metadata) < 0)
+    {
+	probe.error = errno;
+	return probe;
+    }
+
+    auto mode = probe.metadata.stx_mode;
+    if ((checks & PathCheck::File) and not S_ISREG(mode))
+	probe.error = EINVAL;
+    else if ((checks & PathCheck::Directory) and not S_ISDIR(mode))
+	probe.error = ENOTDIR;
+    if (probe.error != 0)
+	return probe;
+
+    int access = ((checks & PathCheck::Readable) ? R_OK : 0)
+	| ((checks & PathCheck::Writable) ? W_OK : 0)
+	| ((checks & PathCheck::Executable) ? X_OK : 0);
+    if (access != 0 and ::faccessat(AT_FDCWD, path.c_str(), access, AT_EACCESS) < 0)
+    {
+	probe.error = errno;
+	return probe;
+    }
+
+    if (checks & PathCheck::Open)
+    {
+	int fd = ::openat(AT_FDCWD, path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	    probe.error = errno;
+	else
+	    probe.file = std::make_shared<const FileDescriptor>(fd);
+    }
+    return probe;
+}
+
+struct PathPrefetch::State
+{
+    State(std::span<const std::string> arg_paths, unsigned arg_checks)
+	: paths(arg_paths.begin(), arg_paths.end())
+	, checks(arg_checks)
+	, probes(paths.size())
+	, ready(paths.size())
+    { }
+    
+    // Claim and probe the next path, returning false when none are left.
+    bool step()
+    {
+	auto idx = next.fetch_add(1, std::memory_order_relaxed);
+	if (idx >= paths.size())
+	    return false;
+	probes[idx] = probe_path(paths[idx], checks);
+	ready[idx].store(true, std::memory_order_release);
+	ready[idx].notify_one();
+	return true;
+    }
+    
+    // Probe paths until none are left or the prefetch is abandoned.
+    void work()
+    {
+	while (not abandoned.load(std::memory_order_relaxed) and step())
+	    ;
+    }
+    
+    std::vector<std::string> paths;
+    unsigned checks;
+    std::vector<PathProbe> probes;
+    std::vector<std::atomic<bool>> ready;
+    std::atomic<size_t> next{0};
+    std::atomic<bool> abandoned{false};
+};
+
+PathPrefetch::PathPrefetch(std::span<const std::string> paths, unsigned checks)
+    : state_(std::make_shared<State>(paths, checks))
+{
+    auto nworkers = std::min(paths.size(), IoThreads);
+    for (size_t i = 0; i < nworkers; ++i)
+	io_pool().post([state = state_]() { state->work(); });
+}
+
+PathPrefetch::~PathPrefetch()
+{
+    state_->abandoned = true;
+}
+
+PathProbe PathPrefetch::take(size_t idx)
+{
+    // The caller may outpace the pool, so it probes unclaimed paths itself.
+    auto& state = *state_;
+    while (state.next.load(std::memory_order_relaxed) <= idx and state.step())
+	;
+    state.ready[idx].wait(false, std::memory_order_acquire);
+    return std::move(state.probes[idx]);
+}
+
+}; // core::argp
@@ -0,0 +1,28 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include "core/argparse/reloadable.h"
+
+namespace core::argp
+{
+
+static std::atomic<bool> reload_requested{false};
+
+static void on_reload_signal(int)
+{ reload_requested.store(true); }
+
+void install_reload_signal(int signo)
+{
+    struct sigaction action{};
+    action.sa_handler = on_reload_signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    ::sigaction(signo, &action, nullptr);
+}
+
+bool take_reload_request()
+{
+    return reload_requested.exchange(false);
+}
+
+}; // core::argp
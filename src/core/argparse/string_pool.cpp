@@ -0,0 +1,52 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <functional>
+#include <stdexcept>
+#include "core/argparse/string_pool.h"
+
+void StringTable::emplace_back(std::string_view str)
+{
+    // Keep the load factor at or below one half.
+    if (2 * (unique_.size() + 1) > slots_.size())
+	rehash(std::max<size_t>(16, 2 * slots_.size()));
+
+    auto mask = slots_.size() - 1;
+    auto slot = std::hash<std::string_view>{}(str) & mask;
+    while (slots_[slot] != Empty)
+    {
+	if (unique_[slots_[slot]] == str)
+	{
+	    ids_.push_back(slots_[slot]);
+	    return;
+	}
+	slot = (slot + 1) & mask;
+    }
+
+    if (unique_.size() >= Empty)
+	throw std::length_error("StringTable: too many distinct strings");
+    uint32_t id = unique_.size();
+    unique_.emplace_back(str);
+    slots_[slot] = id;
+    ids_.push_back(id);
+}
+
+void StringTable::clear()
+{
+    unique_.clear();
+    ids_.clear();
+    slots_.clear();
+}
+
+void StringTable::rehash(size_t nslots)
+{
+    slots_.assign(nslots, Empty);
+    auto mask = nslots - 1;
+    for (uint32_t id = 0; id < unique_.size(); ++id)
+    {
+	auto slot = std::hash<std::string_view>{}(unique_[id]) & mask;
+	while (slots_[slot] != Empty)
+	    slot = (slot + 1) & mask;
+	slots_[slot] = id;
+    }
+}
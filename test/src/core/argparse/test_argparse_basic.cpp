@@ -4,6 +4,8 @@
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 #include <list>
+#include <map>
+#include <unordered_set>
 #include "core/argparse/argp.h"
 #include "core/argparse/detail/message.h"
 
@@ -11,6 +13,13 @@ using namespace core::argp::interface;
 namespace argp = core::argp;
 using namespace std::string_literals;
 
+static constinit ArgParse StaticOpts
+(
+ argFlag<'a'>("aflag", "Flag A"),
+ argValue<'b',int>("bint", "Int B"),
+ argValues<'c', std::vector, int>("cint", "Ints C")
+ );
+
 TEST(ArgParse, ArgFlag)
 {
     ArgParse opts
@@ -110,6 +119,201 @@ TEST(ArgParse, ArgValues)
     EXPECT_EQ(opts.get<'a'>(), (std::vector<int>{ -10, 7 }));
     EXPECT_EQ(opts.get<'b'>(), std::list<std::string>{"foo"});
     EXPECT_EQ(opts.get<'c'>(), (std::set<int>{1, 2, 3}));
+    EXPECT_EQ(opts.get_count<'a'>(), 1);
+    EXPECT_EQ(opts.get_count<'c'>(), 1);
+}
+
+TEST(ArgParse, ArgValuesContainers)
+{
+    ArgParse opts
+	(
+	 argValues<'a', std::array<int,3>>("aint", "Ints A"),
+	 argValues<'b', std::unordered_set<int>>("bset", "Ints B"),
+	 argValues<'c', std::map<std::string,int>>("cmap", "Map C"),
+	 argValues<'d', std::set, int>("dset", "Ints D")
+	 );
+    opts.parse({"program", "-a", "1", "2", "3", "-b", "4", "4", "5",
+		"-c", "x=1", "y=2", "x=3", "-d", "3", "1", "-d", "2", "1"});
+
+    EXPECT_EQ(opts.get<'a'>(), (std::array<int,3>{ 1, 2, 3 }));
+    EXPECT_EQ(opts.get<'b'>(), (std::unordered_set<int>{ 4, 5 }));
+    EXPECT_EQ(opts.get<'c'>(), (std::map<std::string,int>{ {"x", 3}, {"y", 2} }));
+    EXPECT_EQ(opts.get<'d'>(), (std::set<int>{ 1, 2, 3 }));
+
+    EXPECT_THROW(opts.parse({"program", "-a", "1", "2"}), argp::too_few_values_error);
+    EXPECT_THROW(opts.parse({"program", "-a", "1", "2", "3", "4"}), argp::too_many_values_error);
+    EXPECT_THROW(opts.parse({"program", "-c", "x"}), argp::bad_value_error);
+}
+
+TEST(ArgParse, AttachedValue)
+{
+    ArgParse opts
+	(
+	 argFlag<'a'>("aflag", "Flag A"),
+	 argFlag<'b'>("bflag", "Flag B"),
+	 argValue<'n',int>("nint", "Int N"),
+	 argValue<'s',std::string>("sstr", "String S"),
+	 argValues<'d', std::vector, int>("dint", "Ints D")
+	 );
+    opts.parse({"program", "--nint=-10", "--sstr=", "-d1", "2", "--dint=3", "4"});
+
+    EXPECT_EQ(opts.get<'n'>(), -10);
+    EXPECT_EQ(opts.get<'s'>(), "");
+    EXPECT_EQ(opts.get<'d'>(), (std::vector<int>{ 1, 2, 3, 4 }));
+    EXPECT_EQ(opts.get<'a'>(), false);
+}
+
+TEST(ArgParse, AttachedValueGroup)
+{
+    ArgParse opts
+	(
+	 argFlag<'a'>("aflag", "Flag A"),
+	 argFlag<'b'>("bflag", "Flag B"),
+	 argValue<'n',int>("nint", "Int N"),
+	 argValue<'s',std::string>("sstr", "String S")
+	 );
+    opts.parse({"program", "-abn5", "-bs", "foo"});
+
+    EXPECT_EQ(opts.get<'a'>(), true);
+    EXPECT_EQ(opts.get_count<'b'>(), 2);
+    EXPECT_EQ(opts.get<'n'>(), 5);
+    EXPECT_EQ(opts.get<'s'>(), "foo");
+}
+
+TEST(ArgParse, AttachedValueEndsValues)
+{
+    auto make = []() {
+	return ArgParse
+	    (
+	     argFlag<'v'>("verbose", "Verbose"),
+	     argValue<'n',int>("nint", "Int N"),
+	     argValues<'d', std::vector, int>("dint", "Ints D"),
+	     argValues<'f', std::vector, std::string>("files", "Files")
+	     );
+    };
+
+    auto opts = make();
+    opts.parse({"program", "-d", "1", "2", "-n5"});
+    EXPECT_EQ(opts.get<'d'>(), (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(opts.get<'n'>(), 5);
+
+    auto group = make();
+    group.parse({"program", "-d", "1", "2", "-vn5"});
+    EXPECT_EQ(group.get<'d'>(), (std::vector<int>{ 1, 2 }));
+    EXPECT_TRUE(group.get<'v'>());
+    EXPECT_EQ(group.get<'n'>(), 5);
+
+    // A group that does not start with a flag is still a value.
+    auto files = make();
+    files.parse({"program", "-f", "a", "b", "-n5", "-f", "-x5"});
+    EXPECT_EQ(files.get<'f'>(), (std::vector<std::string>{ "a", "b", "-x5" }));
+    EXPECT_EQ(files.get<'n'>(), 5);
+}
+
+TEST(ArgParse, ThrowUnexpectedValueError)
+{
+    ArgParse opts
+	(
+	 argFlag<'a'>("aflag", "Flag A"),
+	 argValue<'n',int>("nint", "Int N")
+	 );
+    ASSERT_THROW(opts.parse({"program", "--aflag=1"}), argp::unexpected_value_error);
+    ASSERT_THROW(opts.parse({"program", "-a5"}), argp::unknown_option_error);
+
+    try { opts.parse({"program", "--aflag=1"}); }
+    catch (const argp::unexpected_value_error& e)
+    { EXPECT_EQ(std::string(e.what()), fmt::format(argp::unexpected_value_msg, "--aflag", "1")); }
+
+    try { opts.parse({"program", "--nint=abc"}); }
+    catch (const argp::bad_value_error& e)
+    { EXPECT_EQ(std::string(e.what()), fmt::format(argp::bad_value_msg, "abc", "int", "--nint")); }
+}
+
+TEST(ArgParse, BoundValues)
+{
+    struct Config
+    {
+	bool verbose{false};
+	int threads{4};
+	std::string name{"baz"};
+	std::vector<int> data;
+	std::set<int> ids;
+    };
+    
+    Config config;
+    int sum{0};
+    ArgParse opts
+	(
+	 argFlag<'v'>(&Config::verbose, "verbose", "Verbose"),
+	 argValue<'t'>(&Config::threads, "threads", "Threads"),
+	 argValue<'n'>(&Config::name, "name", "Name"),
+	 argValuesApply<'d'>(&Config::data, "data", "Data", [&](int x) { sum += x; }),
+	 argValues<'i'>(&Config::ids, "ids", "Ids")
+	 );
+    opts.bind(config).parse({"program", "-v", "--threads=8", "-d", "1", "2", "-i", "3", "3"});
+
+    EXPECT_EQ(config.verbose, true);
+    EXPECT_EQ(config.threads, 8);
+    EXPECT_EQ(config.name, "baz");
+    EXPECT_EQ(config.data, (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(config.ids, (std::set<int>{ 3 }));
+    EXPECT_EQ(sum, 3);
+    EXPECT_EQ(opts.get<'t'>(), 8);
+    EXPECT_EQ(opts.get_count<'t'>(), 1);
+
+    ArgParse unbound(argValue<'t'>(&Config::threads, "threads", "Threads"));
+    EXPECT_THROW(unbound.parse({"program", "-t", "2"}), core::argp::unbound_error);
+    EXPECT_THROW(unbound.get<'t'>(), core::argp::unbound_error);
+    EXPECT_THROW(unbound.find("threads"), core::argp::unbound_error);
+    char buffer[64];
+    EXPECT_THROW(unbound.dump(buffer), core::argp::unbound_error);
+}
+
+TEST(ArgParse, Constinit)
+{
+    StaticOpts.parse({"program", "-a", "-b", "7", "-c", "1", "2"});
+
+    EXPECT_EQ(StaticOpts.get<'a'>(), true);
+    EXPECT_EQ(StaticOpts.get<'b'>(), 7);
+    EXPECT_EQ(StaticOpts.get<'c'>(), (std::vector<int>{ 1, 2 }));
+}
+
+TEST(ArgParse, Constraints)
+{
+    auto make = []() {
+	return ArgParse
+	    (
+	     argValue<'o',std::string>("output", "Output"),
+	     argValue<'f',std::string>("format", "Format"),
+	     argFlag<'q'>("quiet", "Quiet"),
+	     argFlag<'v'>("verbose", "Verbose"),
+	     argFlag<'x'>("xml", "Xml"),
+	     argFlag<'j'>("json", "Json"),
+	     argRequires<'o','f'>(),
+	     argConflicts<'q','v'>(),
+	     argOneOf<'x','j'>()
+	     );
+    };
+
+    EXPECT_NO_THROW(make().parse({"program", "-x"}));
+    EXPECT_NO_THROW(make().parse({"program", "-o", "a", "-f", "b", "-qj"}));
+    EXPECT_NO_THROW(make().parse({"program", "-f", "b", "-v", "-j"}));
+    EXPECT_THROW(make().parse({"program", "-o", "a", "-x"}), argp::requires_error);
+    EXPECT_THROW(make().parse({"program", "-qvx"}), argp::conflicts_error);
+    EXPECT_THROW(make().parse({"program"}), argp::one_of_error);
+    EXPECT_THROW(make().parse({"program", "-x", "--json"}), argp::constraint_error);
+
+    try { make().parse({"program", "-o", "a", "-x"}); }
+    catch (const argp::requires_error& e)
+    { EXPECT_EQ(std::string(e.what()), fmt::format(argp::requires_msg, "--output", "--format")); }
+    
+    try { make().parse({"program", "-x", "-v", "-q"}); }
+    catch (const argp::conflicts_error& e)
+    { EXPECT_EQ(std::string(e.what()), fmt::format(argp::conflicts_msg, "--quiet", "--verbose")); }
+    
+    try { make().parse({"program"}); }
+    catch (const argp::one_of_error& e)
+    { EXPECT_EQ(std::string(e.what()), fmt::format(argp::one_of_msg, "--xml, --json", 0)); }
 }
 
 TEST(ArgParse, ThrowUnknownOptionError)
@@ -0,0 +1,81 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include "core/argparse/argp.h"
+#include "core/argparse/binary.h"
+
+using namespace core::argp::interface;
+
+static std::vector<std::byte> bytes(std::string_view s)
+{
+    std::vector<std::byte> r;
+    for (auto c : s)
+	r.push_back(std::byte(c));
+    return r;
+}
+
+TEST(ArgParse, Hex)
+{
+    auto key = core::lexical_cast<Hex<4>>("00ff10A7");
+    EXPECT_EQ(key.bytes(), (std::array{ std::byte{0x00}, std::byte{0xff}, std::byte{0x10}, std::byte{0xa7} }));
+    EXPECT_EQ(core::lexical_cast<Hex<4>>("0x00FF10a7"), key);
+    EXPECT_EQ(core::lexical_to_string(key), "00ff10a7");
+
+    std::string digits;
+    std::vector<std::byte> expected;
+    for (int i = 0; i < 37; ++i)
+    {
+	digits += "0123456789abcdefABCDEF"[i % 22];
+	digits += "fedcba9876543210FEDCBA"[i % 22];
+	expected.push_back(std::byte(core::lexical_cast<Hex<1>>(digits.substr(2 * i))[0]));
+    }
+    EXPECT_EQ(core::lexical_cast<Hex<>>(digits).bytes(), expected);
+    EXPECT_TRUE(core::lexical_cast<Hex<>>("").bytes().empty());
+
+    for (auto bad : { "00ff10a", "00ff10a7aa", "00ff1ga7", "0x" })
+	EXPECT_THROW(core::lexical_cast<Hex<4>>(bad), core::lexical_cast_error) << bad;
+    for (auto pos = 0; pos < 20; ++pos)
+    {
+	auto bad = std::string(20, 'a');
+	bad[pos] = "g:/@`G\x80 "[pos % 8];
+	EXPECT_THROW(core::lexical_cast<Hex<>>(bad), core::lexical_cast_error) << pos;
+    }
+}
+
+TEST(ArgParse, Base64)
+{
+    std::vector<std::pair<std::string, std::string>> vectors = {
+	{ "", "" }, { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" },
+	{ "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" }
+    };
+    for (const auto& [plain, encoded] : vectors)
+    {
+	auto value = core::lexical_cast<Base64<>>(encoded);
+	EXPECT_EQ(value.bytes(), bytes(plain)) << encoded;
+	EXPECT_EQ(core::lexical_to_string(value), encoded);
+	auto unpadded = encoded.substr(0, encoded.find('='));
+	EXPECT_EQ(core::lexical_cast<Base64<>>(unpadded).bytes(), bytes(plain)) << unpadded;
+    }
+
+    EXPECT_EQ(core::lexical_cast<Base64<6>>("Zm9vYmFy").bytes(), (std::array{
+		std::byte{'f'}, std::byte{'o'}, std::byte{'o'}, std::byte{'b'}, std::byte{'a'}, std::byte{'r'} }));
+    EXPECT_THROW(core::lexical_cast<Base64<5>>("Zm9vYmFy"), core::lexical_cast_error);
+    for (auto bad : { "Z", "Zm9vY", "Zh==", "Zm9=", "Zm=v", "Zm9v*mFy", "Zm9vYmF-", "====" })
+	EXPECT_THROW(core::lexical_cast<Base64<>>(bad), core::lexical_cast_error) << bad;
+}
+
+TEST(ArgParse, BinaryOption)
+{
+    auto opts = ArgParse(argValue<'k', Hex<2>>("key", "Key"), argValue<'s', Base64<>>("seed", "Seed"));
+    opts.parse({ "program", "-k", "beef", "--seed", "Zm9v" });
+    EXPECT_EQ(opts.get<'k'>()[0], std::byte{0xbe});
+    EXPECT_EQ(opts.get<'s'>().bytes(), bytes("foo"));
+    EXPECT_THROW(opts.parse({ "program", "-k", "beefee" }), core::argp::bad_value_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <unistd.h>
+#include "core/argparse/argp.h"
+
+using namespace core::argp::interface;
+namespace fs = std::filesystem;
+
+static auto make_parser(int& calls)
+{
+    return ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose", [&]() { ++calls; }),
+	 argValue<'n',int>("number", 1, "Number"),
+	 argValue<'s',std::string>("name", "Name"),
+	 argValues<'x',std::vector<double>>("values", "Values"),
+	 argValues<'w',std::set<std::string>>("words", "Words"),
+	 argValuesApply<'m',std::map<std::string,int>>("map", "Map", [&](const auto&) { ++calls; })
+	 );
+}
+
+// Overwrite the count of the first value of the single option cached at
+// `path` and recompute the FNV-1a checksum, as a crafted cache would.
+static void forge_count(const std::string& path, uint64_t count)
+{
+    constexpr size_t HeaderSize = 40, ChecksumOffset = 32;
+    std::string bytes;
+    {
+	std::ifstream file(path, std::ios::binary);
+	bytes.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    ASSERT_GE(bytes.size(), HeaderSize + 2 * sizeof(uint64_t));
+    std::memcpy(bytes.data() + HeaderSize + sizeof(size_t), &count, sizeof(count));
+
+    uint64_t checksum{0xcbf29ce484222325ull};
+    for (size_t i = HeaderSize; i < bytes.size(); ++i)
+	checksum = (checksum ^ static_cast<unsigned char>(bytes[i])) * 0x100000001b3ull;
+    std::memcpy(bytes.data() + ChecksumOffset, &checksum, sizeof(checksum));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+}
+
+class Cache : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+	path = fs::temp_directory_path() / ("argparse_cache_" + std::to_string(::getpid()));
+	fs::remove(path);
+    }
+
+    void TearDown() override
+    { fs::remove(path); }
+
+    std::string path;
+};
+
+TEST_F(Cache, HitRestoresValues)
+{
+    std::vector<std::string> args = { "program", "-v", "-n", "42", "--name=abc",
+				      "-x", "1.5", "2.5", "-w", "b", "a", "b",
+				      "-m", "k=1", "j=2", "-v" };
+    int calls{0};
+    auto opts = make_parser(calls);
+    EXPECT_FALSE(opts.parse_cached(path, args));
+    EXPECT_EQ(calls, 4);
+    EXPECT_TRUE(fs::exists(path));
+
+    int cached_calls{0};
+    auto cached = make_parser(cached_calls);
+    EXPECT_TRUE(cached.parse_cached(path, args));
+    EXPECT_EQ(cached_calls, 4);
+    EXPECT_EQ(cached.get<'v'>(), true);
+    EXPECT_EQ(cached.get_count<'v'>(), 2);
+    EXPECT_EQ(cached.get<'n'>(), 42);
+    EXPECT_EQ(cached.get<'s'>(), "abc");
+    EXPECT_EQ(cached.get<'x'>(), (std::vector<double>{ 1.5, 2.5 }));
+    EXPECT_EQ(cached.get<'w'>(), (std::set<std::string>{ "a", "b" }));
+    EXPECT_EQ(cached.get<'m'>(), (std::map<std::string,int>{ {"j", 2}, {"k", 1} }));
+    EXPECT_EQ(cached.get_count<'s'>(), 1);
+}
+
+TEST_F(Cache, MissOnChange)
+{
+    int calls{0};
+    auto opts = make_parser(calls);
+    EXPECT_FALSE(opts.parse_cached(path, { "program", "-n", "1" }));
+
+    auto other = make_parser(calls);
+    EXPECT_FALSE(other.parse_cached(path, { "program", "-n", "2" }));
+    EXPECT_EQ(other.get<'n'>(), 2);
+
+    auto dep = path + ".dep";
+    std::ofstream(dep) << "a";
+    auto first = make_parser(calls);
+    EXPECT_FALSE(first.parse_cached(path, { "program", "-n", "2" }, { dep }));
+    auto second = make_parser(calls);
+    EXPECT_TRUE(second.parse_cached(path, { "program", "-n", "2" }, { dep }));
+    
+    std::ofstream(dep) << "ab";
+    auto third = make_parser(calls);
+    EXPECT_FALSE(third.parse_cached(path, { "program", "-n", "2" }, { dep }));
+    fs::remove(dep);
+}
+
+TEST_F(Cache, CorruptFallsBack)
+{
+    int calls{0};
+    auto opts = make_parser(calls);
+    EXPECT_FALSE(opts.parse_cached(path, { "program", "-n", "7" }));
+    {
+	std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+	file.seekp(-1, std::ios::end);
+	file.put('\xff');
+    }
+    auto other = make_parser(calls);
+    EXPECT_FALSE(other.parse_cached(path, { "program", "-n", "7" }));
+    EXPECT_EQ(other.get<'n'>(), 7);
+}
+
+TEST_F(Cache, ForgedCountFallsBack)
+{
+    std::vector<std::string> args = { "program", "-x", "1", "2" };
+    auto make_doubles = []() { return ArgParse(argValues<'x',std::vector<double>>("values", "Values")); };
+    auto make_strings = []() { return ArgParse(argValues<'x',std::vector<std::string>>("values", "Values")); };
+
+    for (uint64_t count : { uint64_t{1} << 61, uint64_t{1} << 33, uint64_t{3} })
+    {
+	fs::remove(path);
+	auto doubles = make_doubles();
+	EXPECT_FALSE(doubles.parse_cached(path, args));
+	forge_count(path, count);
+	auto forged = make_doubles();
+	EXPECT_FALSE(forged.parse_cached(path, args));
+	EXPECT_EQ(forged.get<'x'>(), (std::vector<double>{ 1, 2 }));
+
+	fs::remove(path);
+	auto strings = make_strings();
+	EXPECT_FALSE(strings.parse_cached(path, args));
+	forge_count(path, count);
+	auto forged_strings = make_strings();
+	EXPECT_FALSE(forged_strings.parse_cached(path, args));
+	EXPECT_EQ(forged_strings.get<'x'>(), (std::vector<std::string>{ "1", "2" }));
+    }
+}
+
+TEST_F(Cache, IgnoresPlantedTemporary)
+{
+    auto victim = path + ".victim";
+    std::ofstream(victim) << "keep";
+    fs::create_symlink(victim, path + ".tmp." + std::to_string(::getpid()));
+
+    int calls{0};
+    auto opts = make_parser(calls);
+    EXPECT_FALSE(opts.parse_cached(path, { "program", "-n", "3" }));
+    auto cached = make_parser(calls);
+    EXPECT_TRUE(cached.parse_cached(path, { "program", "-n", "3" }));
+
+    std::string text;
+    std::ifstream(victim) >> text;
+    EXPECT_EQ(text, "keep");
+    fs::remove(path + ".tmp." + std::to_string(::getpid()));
+    fs::remove(victim);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
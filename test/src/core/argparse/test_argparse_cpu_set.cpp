@@ -0,0 +1,89 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <latch>
+#include <thread>
+#include <vector>
+#include "core/argparse/argp.h"
+#include "core/argparse/cpu_set.h"
+
+using namespace core::argp::interface;
+
+TEST(ArgParse, CpuSet)
+{
+    auto available = CpuSet::available();
+    ASSERT_FALSE(available.empty());
+    EXPECT_EQ(core::lexical_cast<CpuSet>(core::lexical_to_string(available)), available);
+
+    auto first = available[0];
+    auto set = core::lexical_cast<CpuSet>(std::to_string(first));
+    EXPECT_EQ(set.size(), 1);
+    EXPECT_TRUE(set.contains(first));
+    auto native = set.native();
+    EXPECT_TRUE(CPU_ISSET(first, &native));
+    EXPECT_EQ(CPU_COUNT(&native), 1);
+    
+    EXPECT_THROW(core::lexical_cast<CpuSet>(""), core::lexical_cast_error);
+    EXPECT_THROW(core::lexical_cast<CpuSet>("3-1"), core::lexical_cast_error);
+    EXPECT_THROW(core::lexical_cast<CpuSet>("0,"), core::lexical_cast_error);
+    EXPECT_THROW(core::lexical_cast<CpuSet>("100000"), core::lexical_cast_error);
+    for (size_t cpu = 0; cpu < CpuSet::Capacity; ++cpu)
+	if (not available.contains(cpu))
+	{
+	    EXPECT_THROW(core::lexical_cast<CpuSet>(std::to_string(cpu)), core::lexical_cast_error);
+	    break;
+	}
+}
+
+TEST(ArgParse, IdSetSyntax)
+{
+    auto ids = core::lexical_cast_detail::parse_id_set<NumaSet>("8-12:2,0-3,5", "NumaSet");
+    EXPECT_EQ(std::vector<size_t>(ids.begin(), ids.end()), (std::vector<size_t>{0, 1, 2, 3, 5, 8, 10, 12}));
+    EXPECT_EQ(ids[5], 8);
+    EXPECT_EQ(core::lexical_cast_detail::id_set_to_string(ids), "0-3,5,8,10,12");
+
+    auto huge = core::lexical_cast_detail::parse_id_set<NumaSet>("3-5:18446744073709551614", "NumaSet");
+    EXPECT_EQ(std::vector<size_t>(huge.begin(), huge.end()), (std::vector<size_t>{3}));
+    auto wide = core::lexical_cast_detail::parse_id_set<NumaSet>("0-1023:1000,7-7:3", "NumaSet");
+    EXPECT_EQ(std::vector<size_t>(wide.begin(), wide.end()), (std::vector<size_t>{0, 7, 1000}));
+}
+
+TEST(ArgParse, NumaSet)
+{
+    auto online = NumaSet::online();
+    ASSERT_FALSE(online.empty());
+    auto opts = ArgParse(argValue<'n',NumaSet>("numa", "NUMA nodes"),
+			 argValue<'c',CpuSet>("cpus", "CPUs"));
+    opts.parse({ "program", "--numa", core::lexical_to_string(online) });
+    EXPECT_EQ(opts.get<'n'>(), online);
+    EXPECT_FALSE(opts.get<'n'>().cpus().empty());
+    EXPECT_THROW(opts.parse({ "program", "--numa", "1023" }), core::argp::error);
+}
+
+TEST(ArgParse, CpuSetPin)
+{
+    auto available = CpuSet::available();
+    auto last = CpuSet{available[available.size() - 1]};
+    std::thread([&]() {
+	available.pin(available.size() - 1);
+	EXPECT_EQ(CpuSet::available(), last);
+	available.pin();
+	EXPECT_EQ(CpuSet::available(), available);
+    }).join();
+
+    std::latch pinned{1};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i)
+	threads.emplace_back([&]() { pinned.wait(); });
+    available.spread(threads);
+    pinned.count_down();
+    for (auto& thread : threads)
+	thread.join();
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <new>
+#include <unistd.h>
+#include "core/argparse/argp.h"
+
+using namespace core::argp::interface;
+
+static std::atomic<size_t> allocations{0};
+
+// Every replaceable form is replaced, and the deallocation functions are
+// kept out of line, so no pointer from one allocator reaches the other.
+void *operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    ++allocations;
+    return std::malloc(size ? size : 1);
+}
+
+void *operator new(size_t size)
+{
+    if (auto ptr = operator new(size, std::nothrow))
+	return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{ return operator new(size); }
+
+void *operator new[](size_t size, const std::nothrow_t&) noexcept
+{ return operator new(size, std::nothrow); }
+
+[[gnu::noinline]] void operator delete(void *ptr) noexcept
+{ std::free(ptr); }
+
+[[gnu::noinline]] void operator delete(void *ptr, size_t) noexcept
+{ std::free(ptr); }
+
+[[gnu::noinline]] void operator delete(void *ptr, const std::nothrow_t&) noexcept
+{ std::free(ptr); }
+
+[[gnu::noinline]] void operator delete[](void *ptr) noexcept
+{ std::free(ptr); }
+
+[[gnu::noinline]] void operator delete[](void *ptr, size_t) noexcept
+{ std::free(ptr); }
+
+[[gnu::noinline]] void operator delete[](void *ptr, const std::nothrow_t&) noexcept
+{ std::free(ptr); }
+
+static auto make_parser()
+{
+    return ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose diagnostics"),
+	 argValue<'r', double>("rate", 0.5, "Rate"),
+	 argValue<'o', std::string>("output", "Output file"),
+	 argValues<'m', std::map<std::string, int>>("map", "Map"),
+	 argValues<'*', std::vector, std::string>("files", "Files", 0)
+	 );
+}
+
+TEST(ArgParse, DumpJson)
+{
+    auto opts = make_parser();
+    opts.parse({ "program", "-v", "-o", "say \"hi\"\n", "-m", "a=1", "b=2", "--", "x" });
+
+    char buffer[512];
+    auto before = allocations.load();
+    auto size = opts.dump(buffer);
+    EXPECT_EQ(allocations.load(), before);
+    EXPECT_EQ(std::string_view(buffer, size),
+	      R"({"verbose":{"count":1,"origin":"command-line","value":true},)"
+	      R"("rate":{"count":0,"origin":"default","value":0.5},)"
+	      R"("output":{"count":1,"origin":"command-line","value":"say \"hi\"\n"},)"
+	      R"("map":{"count":1,"origin":"command-line","value":[["a",1],["b",2]]},)"
+	      R"("files":{"count":1,"origin":"command-line","value":["x"]}})");
+
+    char small[16];
+    EXPECT_EQ(opts.dump(small), size);
+    EXPECT_EQ(std::string_view(small, sizeof(small)), std::string_view(buffer, sizeof(small)));
+    EXPECT_EQ(opts.dump(std::span<char>{}), size);
+}
+
+TEST(ArgParse, DumpKeyValue)
+{
+    auto opts = make_parser();
+    opts.parse({ "program", "-r", "1e-3", "-o", "a b", "-m", "a=1", "--", "x", "y" });
+
+    char buffer[512];
+    auto before = allocations.load();
+    auto size = opts.dump(buffer, DumpFormat::KeyValue);
+    EXPECT_EQ(allocations.load(), before);
+    EXPECT_EQ(std::string_view(buffer, size),
+	      "name=verbose count=0 origin=default value=false\n"
+	      "name=rate count=1 origin=command-line value=0.001\n"
+	      "name=output count=1 origin=command-line value=\"a b\"\n"
+	      "name=map count=1 origin=command-line value=a:1\n"
+	      "name=files count=1 origin=command-line value=x,y\n");
+
+    // A colon in a key would otherwise run into the key:value separator.
+    auto colon = make_parser();
+    colon.parse({ "program", "-m", "a:b=1" });
+    size = colon.dump(buffer, DumpFormat::KeyValue);
+    EXPECT_NE(std::string_view(buffer, size).find("name=map count=1 origin=command-line value=\"a:b\":1\n"),
+	      std::string_view::npos) << std::string_view(buffer, size);
+}
+
+TEST(ArgParse, DumpOrigin)
+{
+    auto path = (std::filesystem::temp_directory_path()
+		 / ("argparse_dump_" + std::to_string(::getpid()))).string();
+    std::vector<std::string> args{ "program", "-v" };
+    auto first = ArgParse(argFlag<'v'>("verbose", "Verbose"), argValue<'t', int>("threads", "Threads"));
+    EXPECT_FALSE(first.parse_cached(path, args));
+    auto second = ArgParse(argFlag<'v'>("verbose", "Verbose"), argValue<'t', int>("threads", "Threads"));
+    EXPECT_TRUE(second.parse_cached(path, args));
+    std::filesystem::remove(path);
+
+    char buffer[256];
+    auto size = second.dump(buffer, DumpFormat::KeyValue);
+    EXPECT_EQ(std::string_view(buffer, size),
+	      "name=verbose count=1 origin=cache value=true\n"
+	      "name=threads count=0 origin=default value=0\n");
+
+    auto feeder = second.feeder();
+    feeder.feed("-t");
+    feeder.feed("3");
+    feeder.finish();
+    size = second.dump(buffer, DumpFormat::KeyValue);
+    EXPECT_NE(std::string_view(buffer, size).find("name=threads count=1 origin=command-line value=3\n"),
+	      std::string_view::npos) << std::string_view(buffer, size);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "core/argparse/argp.h"
+#include "core/argparse/enum.h"
+
+using namespace core::argp::interface;
+
+enum class Algo { Lz4, Zstd, None };
+using AlgoArg = Enum<Algo, "lz4", "zstd", "none">;
+
+TEST(ArgParse, Enum)
+{
+    EXPECT_EQ(core::lexical_cast<AlgoArg>("lz4"), Algo::Lz4);
+    EXPECT_EQ(core::lexical_cast<AlgoArg>("zstd"), Algo::Zstd);
+    EXPECT_EQ(core::lexical_cast<AlgoArg>("none"), Algo::None);
+    EXPECT_EQ(core::lexical_to_string(AlgoArg{Algo::Zstd}), "zstd");
+    EXPECT_EQ(AlgoArg::spec_name(), "lz4|zstd|none");
+    EXPECT_EQ(AlgoArg{static_cast<Algo>(3)}.name(), "");
+    EXPECT_EQ(AlgoArg{static_cast<Algo>(-1)}.name(), "");
+
+    for (auto bad : { "", "lz", "lz44", "LZ4", "zstd ", "non" })
+	EXPECT_THROW(core::lexical_cast<AlgoArg>(bad), core::lexical_cast_error) << bad;
+}
+
+TEST(ArgParse, EnumPerfectHash)
+{
+    enum class Level { L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11 };
+    using LevelArg = Enum<Level, "l0", "l1", "l2", "l3", "l4", "l5", "l6", "l7", "l8", "l9", "l10", "l11">;
+    for (size_t idx = 0; idx < LevelArg::Choices.size(); ++idx)
+    {
+	auto name = LevelArg::Choices[idx];
+	EXPECT_EQ(LevelArg::Index.find(name, LevelArg::Choices), idx) << name;
+	EXPECT_EQ(core::lexical_cast<LevelArg>(name).name(), name);
+    }
+    EXPECT_EQ(LevelArg::Index.find("l12", LevelArg::Choices), -1);
+
+    enum class Single { Only };
+    using SingleArg = Enum<Single, "only">;
+    EXPECT_EQ(core::lexical_cast<SingleArg>("only"), Single::Only);
+    EXPECT_THROW(core::lexical_cast<SingleArg>("other"), core::lexical_cast_error);
+}
+
+TEST(ArgParse, EnumOption)
+{
+    auto opts = ArgParse
+	(
+	 argValue<'a', AlgoArg>("algo", Algo::Lz4, "Compression algorithm"),
+	 argValues<'*', std::vector, AlgoArg>("algos", "Algorithms to compare")
+	 );
+
+    opts.parse({ "program" });
+    EXPECT_EQ(opts.get<'a'>(), Algo::Lz4);
+
+    opts.parse({ "program", "--algo", "none", "zstd", "lz4" });
+    EXPECT_EQ(opts.get<'a'>(), Algo::None);
+    EXPECT_EQ(opts.get<'*'>(), (std::vector<AlgoArg>{ Algo::Zstd, Algo::Lz4 }));
+
+    EXPECT_THROW(opts.parse({ "program", "-a", "gzip" }), core::argp::bad_value_error);
+    EXPECT_THROW(opts.parse({ "program", "snappy" }), core::argp::bad_value_error);
+
+    std::ostringstream help;
+    opts.output_help_message(help, { "program" });
+    EXPECT_NE(help.str().find("lz4|zstd|none"), std::string::npos) << help.str();
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
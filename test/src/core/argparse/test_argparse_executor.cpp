@@ -0,0 +1,100 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include "core/argparse/argp.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+
+TEST(ArgParse, ExecutorOrdering)
+{
+    ThreadPool pool(4);
+    std::vector<int> xs, ys;
+    std::atomic<int> flags{0};
+    std::atomic<bool> other_thread{false};
+    auto main_thread = std::this_thread::get_id();
+    
+    auto opts = ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose", [&]() { ++flags; }),
+	 argValuesApply<'x',std::vector<int>>("xs", "Xs", [&](int x) {
+	     std::this_thread::sleep_for(std::chrono::milliseconds(x % 2 ? 2 : 0));
+	     xs.push_back(x);
+	     other_thread = other_thread or std::this_thread::get_id() != main_thread;
+	 }),
+	 argValuesApply<'y',std::vector<int>>("ys", "Ys", [&](int y) { ys.push_back(y); })
+	 );
+    opts.executor(pool.executor());
+
+    std::vector<std::string> args{ "program" };
+    for (int i = 0; i < 20; ++i)
+	for (auto token : { "-v", "-x", "-y" })
+	{
+	    args.push_back(token);
+	    if (token[1] != 'v')
+		args.push_back(std::to_string(i));
+	}
+    opts.parse(args);
+
+    std::vector<int> expected(20);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(xs, expected);
+    EXPECT_EQ(ys, expected);
+    EXPECT_EQ(flags, 20);
+    EXPECT_EQ(opts.get<'x'>(), expected);
+    EXPECT_TRUE(other_thread);
+}
+
+TEST(ArgParse, ExecutorException)
+{
+    ThreadPool pool(2);
+    std::atomic<int> calls{0};
+    auto opts = ArgParse
+	(
+	 argValuesApply<'x',std::vector<int>>("xs", "Xs", [&](int x) {
+	     ++calls;
+	     if (x == 3)
+		 throw std::runtime_error("bad x");
+	 }),
+	 argValue<'n',int>("number", "Number")
+	 );
+    opts.executor(pool.executor());
+
+    EXPECT_THROW(opts.parse({ "program", "-x", "1", "2", "3", "4" }), std::runtime_error);
+    EXPECT_EQ(calls, 4);
+
+    calls = 0;
+    EXPECT_THROW(opts.parse({ "program", "-x", "3", "-n", "abc" }), argp::bad_value_error);
+    EXPECT_EQ(calls, 1);
+    
+    calls = 0;
+    EXPECT_NO_THROW(opts.parse({ "program", "-x", "1" }));
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ArgParse, ExecutorFeeder)
+{
+    ThreadPool pool(2);
+    std::atomic<int> calls{0};
+    auto opts = ArgParse(argValuesApply<'*',Discard<std::string>>("files", "Files", [&](const std::string&) {
+	++calls;
+    }));
+    opts.executor(pool.executor());
+
+    auto feeder = opts.feeder();
+    for (int i = 0; i < 1000; ++i)
+	feeder.feed("file" + std::to_string(i));
+    feeder.finish();
+    EXPECT_EQ(calls, 1000);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
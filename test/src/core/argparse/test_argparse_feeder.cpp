@@ -0,0 +1,140 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include "core/argparse/argp.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+
+static auto make_parser()
+{
+    return ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose"),
+	 argFlag<'q'>("quiet", "Quiet"),
+	 argValue<'n',int>("number", "Number"),
+	 argValue<'s',std::string>("name", "Name"),
+	 argValues<'x',std::vector<int>>("values", "Values"),
+	 argValues<'*',std::vector<std::string>>("files", "Files")
+	 );
+}
+
+TEST(ArgParse, FeederMatchesParse)
+{
+    std::vector<std::string> args = { "program", "-vq", "-n7", "-n", "5", "--name=abc",
+				      "-x", "1", "2", "3", "-v", "a", "b", "--", "c", "d" };
+    auto expected = make_parser();
+    expected.parse(args);
+    
+    auto opts = make_parser();
+    auto feeder = opts.feeder();
+    for (size_t i = 1; i < args.size(); ++i)
+	feeder.feed(args[i]);
+    feeder.finish();
+
+    EXPECT_EQ(opts.get<'v'>(), expected.get<'v'>());
+    EXPECT_EQ(opts.get_count<'v'>(), 2);
+    EXPECT_EQ(opts.get<'q'>(), true);
+    EXPECT_EQ(opts.get<'n'>(), 5);
+    EXPECT_EQ(opts.get_count<'n'>(), 2);
+    EXPECT_EQ(opts.get<'s'>(), "abc");
+    EXPECT_EQ(opts.get<'x'>(), expected.get<'x'>());
+    EXPECT_EQ(opts.get<'*'>(), expected.get<'*'>());
+    EXPECT_EQ(opts.get<'*'>(), (std::vector<std::string>{ "a", "b", "c", "d" }));
+}
+
+TEST(ArgParse, FeederAttachedValueEndsValues)
+{
+    for (auto last : { "-n5", "-vn5" })
+    {
+	auto opts = make_parser();
+	auto feeder = opts.feeder();
+	for (auto token : { "-x", "1", "2", last })
+	    feeder.feed(token);
+	feeder.finish();
+	EXPECT_EQ(opts.get<'x'>(), (std::vector<int>{ 1, 2 }));
+	EXPECT_EQ(opts.get<'n'>(), 5);
+    }
+}
+
+TEST(ArgParse, FeederStream)
+{
+    size_t count{0}, bytes{0};
+    auto opts = ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose"),
+	 argValuesApply<'*',Discard<std::string>>("files", "Files", [&](const std::string& path) {
+	     ++count;
+	     bytes += path.size();
+	 })
+	 );
+    
+    auto feeder = opts.feeder();
+    feeder.feed("-v");
+    for (size_t i = 0; i < 100'000; ++i)
+    {
+	feeder.feed("path/" + std::to_string(i));
+	EXPECT_EQ(count, i + 1);
+    }
+    feeder.finish();
+    EXPECT_EQ(count, 100'000);
+    EXPECT_EQ(opts.get<'*'>().size(), 100'000);
+    EXPECT_TRUE(opts.get<'v'>());
+}
+
+TEST(ArgParse, FeederEdgeCases)
+{
+    {
+	auto opts = make_parser();
+	auto feeder = opts.feeder();
+	feeder.feed("-n");
+	EXPECT_THROW(feeder.finish(), argp::missing_value_error);
+    }
+    {
+	auto opts = make_parser();
+	auto feeder = opts.feeder();
+	feeder.feed("-n");
+	EXPECT_THROW(feeder.feed("-v"), argp::missing_value_error);
+    }
+    {
+	auto opts = make_parser();
+	auto feeder = opts.feeder();
+	feeder.feed("-n");
+	EXPECT_THROW(feeder.feed("abc"), argp::bad_value_error);
+    }
+    {
+	auto opts = make_parser();
+	auto feeder = opts.feeder();
+	feeder.feed("--");
+	feeder.feed("-c");
+	feeder.finish();
+	EXPECT_EQ(opts.get<'*'>(), (std::vector<std::string>{ "-c" }));
+    }
+    {
+	auto opts = make_parser();
+	auto feeder = opts.feeder();
+	EXPECT_THROW(feeder.feed("--numbr"), argp::unknown_option_error);
+	EXPECT_THROW(feeder.feed("--verbose=1"), argp::unexpected_value_error);
+    }
+    {
+	auto opts = make_parser();
+	EXPECT_THROW(opts.parse({ "program", "-v*" }), argp::unknown_option_error);
+	auto feeder = opts.feeder();
+	EXPECT_THROW(feeder.feed("-v*"), argp::unknown_option_error);
+	EXPECT_THROW(feeder.feed("-vz"), argp::unknown_option_error);
+    }
+    {
+	auto opts = ArgParse(argValues<'x',std::vector<int>>("values", "Values", 2, 3));
+	auto feeder = opts.feeder();
+	feeder.feed("-x");
+	feeder.feed("1");
+	EXPECT_THROW(feeder.finish(), argp::too_few_values_error);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
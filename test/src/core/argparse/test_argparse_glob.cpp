@@ -0,0 +1,144 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <unistd.h>
+#include "core/argparse/argp.h"
+#include "core/argparse/path.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+namespace fs = std::filesystem;
+
+class GlobTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+	dir = (fs::temp_directory_path() / ("argparse_glob_" + std::to_string(::getpid()))).string();
+	for (auto file : { "top.txt", "w.log", "a/x.txt", "a/b/y.txt", "a/b/c/z.txt", "d/v.txt",
+			   ".hidden/h.txt", "a/.h.txt", "star*/s.txt" })
+	    touch(file);
+	fs::create_symlink(dir + "/a", dir + "/link");
+    }
+
+    void TearDown() override
+    { fs::remove_all(dir); }
+
+    void touch(const std::string& file)
+    {
+	auto path = fs::path(dir) / file;
+	fs::create_directories(path.parent_path());
+	std::ofstream(path) << file;
+    }
+
+    std::vector<std::string> under(std::initializer_list<std::string> files)
+    {
+	std::vector<std::string> r;
+	for (const auto& file : files)
+	    r.push_back(dir + "/" + file);
+	return r;
+    }
+
+    std::string dir;
+};
+
+TEST_F(GlobTest, Patterns)
+{
+    auto glob = [&](std::string pattern) {
+	auto opts = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0)
+			     .with_glob({ .sorted = true }));
+	opts.parse({ "program", dir + "/" + pattern });
+	return opts.get<'*'>();
+    };
+
+    EXPECT_EQ(glob("*.txt"), under({ "top.txt" }));
+    EXPECT_EQ(glob("?.log"), under({ "w.log" }));
+    EXPECT_EQ(glob("*/x.txt"), under({ "a/x.txt", "link/x.txt" }));
+    EXPECT_EQ(glob("a/**/*.txt"), under({ "a/b/c/z.txt", "a/b/y.txt", "a/x.txt" }));
+    EXPECT_EQ(glob("**/[vz].txt"), under({ "a/b/c/z.txt", "d/v.txt" }));
+    EXPECT_EQ(glob("a/**"), under({ "a/b", "a/b/c", "a/b/c/z.txt", "a/b/y.txt", "a/x.txt" }));
+    EXPECT_EQ(glob("a/.*.txt"), under({ "a/.h.txt" }));
+    EXPECT_EQ(glob("star\\*/*"), under({ "star*/s.txt" }));
+    EXPECT_EQ(glob("**/*.txt").size(), 6);
+
+    auto opts = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0).with_glob());
+    opts.parse({ "program", "plain", dir + "/star\\*" });
+    EXPECT_EQ(opts.get<'*'>(), (std::vector<std::string>{ "plain", dir + "/star*" }));
+}
+
+TEST_F(GlobTest, NoMatch)
+{
+    auto opts = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0).with_glob());
+    EXPECT_THROW(opts.parse({ "program", dir + "/*.csv" }), argp::glob_error);
+    EXPECT_THROW(opts.parse({ "program", dir + "/missing/*" }), argp::glob_error);
+
+    auto empty = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0)
+			  .with_glob({ .allow_empty = true }));
+    EXPECT_NO_THROW(empty.parse({ "program", dir + "/*.csv" }));
+    EXPECT_TRUE(empty.get<'*'>().empty());
+}
+
+TEST_F(GlobTest, Parallel)
+{
+    std::vector<std::string> expected;
+    for (int i = 0; i < 40; ++i)
+	for (int j = 0; j < 25; ++j)
+	{
+	    auto file = "tree/" + std::to_string(i % 4) + "/" + std::to_string(i) + "/f" + std::to_string(j) + ".dat";
+	    touch(file);
+	    expected.push_back(dir + "/" + file);
+	}
+    std::sort(expected.begin(), expected.end());
+
+    for (size_t threads : { 1, 2, 8 })
+    {
+	std::set<std::string> seen;
+	auto opts = ArgParse(argValuesApply<'*', Discard<std::string>>
+			     ("files", "Files", [&](const std::string& path) { seen.insert(path); }, 0)
+			     .with_glob({ .threads = threads }));
+	opts.parse({ "program", dir + "/tree/**/*.dat" });
+	EXPECT_EQ(opts.get<'*'>().size(), expected.size()) << threads;
+	EXPECT_EQ(std::vector(seen.begin(), seen.end()), expected) << threads;
+
+	auto sorted = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0)
+			       .with_glob({ .sorted = true, .threads = threads }));
+	sorted.parse({ "program", dir + "/tree/**/*.dat" });
+	EXPECT_EQ(sorted.get<'*'>(), expected) << threads;
+    }
+}
+
+TEST_F(GlobTest, LimitsAndPaths)
+{
+    auto opts = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0).with_glob());
+    opts.limits({ .max_values = 3 });
+    EXPECT_THROW(opts.parse({ "program", dir + "/**/*.txt" }), argp::value_limit_error);
+
+    auto sorted = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0)
+			   .with_glob({ .sorted = true }));
+    sorted.limits({ .max_values = 3 });
+    EXPECT_THROW(sorted.parse({ "program", dir + "/**/*.txt" }), argp::value_limit_error);
+    EXPECT_TRUE(sorted.get<'*'>().empty());
+
+    opts.limits({ .deadline = Limits::Clock::now() - std::chrono::seconds(1) });
+    EXPECT_THROW(opts.parse({ "program", dir + "/**/*.txt" }), argp::deadline_error);
+
+    auto paths = ArgParse(argValues<'*', std::vector, Path<PathCheck::File>>("files", "Files", 0)
+			  .with_glob({ .sorted = true }));
+    paths.parse({ "program", dir + "/a/**/*.txt", dir + "/top.txt" });
+    std::vector<std::string> found;
+    for (const auto& path : paths.get<'*'>())
+	found.push_back(path.path());
+    EXPECT_EQ(found, under({ "a/b/c/z.txt", "a/b/y.txt", "a/x.txt", "top.txt" }));
+    EXPECT_THROW(paths.parse({ "program", dir + "/*" }), argp::bad_value_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
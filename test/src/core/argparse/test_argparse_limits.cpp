@@ -0,0 +1,106 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <set>
+#include "core/argparse/argp.h"
+#include "core/argparse/detail/message.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+
+TEST(ArgParse, LimitTokensAndBytes)
+{
+    auto opts = ArgParse(argValues<'*', std::vector, std::string>("files", "Files", 0));
+    opts.limits({ .max_tokens = 3, .max_bytes = 8 });
+    EXPECT_NO_THROW(opts.parse({ "program", "ab", "cd", "efgh" }));
+
+    try
+    {
+	opts.parse({ "program", "a", "b", "c", "d", "e" });
+	FAIL() << "expected token_limit_error";
+    }
+    catch (const argp::token_limit_error& e)
+    {
+	EXPECT_EQ(e.number_found, 5);
+	EXPECT_EQ(e.number_limit, 3);
+	EXPECT_EQ(e.context.front(), "d");
+    }
+
+    try
+    {
+	opts.parse({ "program", "abcd", "efghi", "j" });
+	FAIL() << "expected byte_limit_error";
+    }
+    catch (const argp::byte_limit_error& e)
+    {
+	EXPECT_EQ(e.number_found, 9);
+	EXPECT_EQ(e.context.front(), "efghi");
+    }
+}
+
+TEST(ArgParse, LimitGroup)
+{
+    auto opts = ArgParse(argFlag<'v'>("verbose", "Verbose"), argValue<'n', int>("number", "Number"));
+    opts.limits({ .max_group = 4 });
+    EXPECT_NO_THROW(opts.parse({ "program", "-vvn5" }));
+
+    std::string group = "-" + std::string(1'000'000, 'v');
+    try
+    {
+	opts.parse({ "program", group });
+	FAIL() << "expected group_limit_error";
+    }
+    catch (const argp::group_limit_error& e)
+    {
+	EXPECT_EQ(e.number_found, 1'000'000);
+	EXPECT_EQ(std::string(e.what()),
+		  fmt::format(argp::group_limit_msg, "-vvvvvvvvvvvvvvv...", 1'000'000, 4));
+    }
+}
+
+TEST(ArgParse, LimitValues)
+{
+    size_t calls{0};
+    auto opts = ArgParse(argValuesApply<'a', std::vector, int>("aint", "Ints A", [&](int) { ++calls; }, 0),
+			 argValues<'b', std::vector, int>("bint", "Ints B", 0, 2),
+			 argValues<'c', std::set, int>("cint", "Ints C", 0));
+    opts.limits({ .max_values = 4 });
+
+    std::vector<std::string> args{ "program", "-a" };
+    for (int i = 0; i < 100'000; ++i)
+	args.push_back(std::to_string(i));
+    EXPECT_THROW(opts.parse(args), argp::value_limit_error);
+    EXPECT_EQ(calls, 4);
+
+    EXPECT_THROW(opts.parse({ "program", "-b", "1", "2", "3", "4", "5", "6" }), argp::too_many_values_error);
+    EXPECT_NO_THROW(opts.parse({ "program", "-c", "1", "1", "2", "2", "1", "2" }));
+    EXPECT_EQ(opts.get<'c'>(), (std::set<int>{ 1, 2 }));
+}
+
+TEST(ArgParse, LimitDeadline)
+{
+    auto opts = ArgParse(argFlag<'v'>("verbose", "Verbose"));
+    opts.limits({ .deadline = Limits::Clock::now() - std::chrono::seconds(1) });
+    EXPECT_THROW(opts.parse({ "program", "-v" }), argp::deadline_error);
+
+    opts.limits({ .deadline = Limits::Clock::now() + std::chrono::hours(1) });
+    EXPECT_NO_THROW(opts.parse({ "program", "-v" }));
+}
+
+TEST(ArgParse, LimitFeeder)
+{
+    auto opts = ArgParse(argValues<'*', Discard<std::string>>("files", "Files", 0));
+    opts.limits({ .max_tokens = 2 });
+    auto feeder = opts.feeder();
+    feeder.feed("one");
+    feeder.feed("two");
+    EXPECT_THROW(feeder.feed("three"), argp::token_limit_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <charconv>
+#include <limits>
+#include "core/argparse/argp.h"
+#include "core/argparse/floating_with_suffix.h"
+#include "core/argparse/integer_with_suffix.h"
+#include "core/argparse/list.h"
+
+using namespace core::argp::interface;
+
+TEST(ArgParse, List)
+{
+    EXPECT_EQ(core::lexical_cast<List<int>>("1,-2,3"), (List<int>{ 1, -2, 3 }));
+    EXPECT_EQ(core::lexical_cast<List<int>>("7"), (List<int>{ 7 }));
+    EXPECT_TRUE(core::lexical_cast<List<int>>("").empty());
+    EXPECT_EQ((core::lexical_cast<List<double,':'>>("0.5:1e3:-2")), (List<double,':'>{ 0.5, 1e3, -2 }));
+    EXPECT_EQ(core::lexical_to_string(List<int>{ 1, 2, 3 }), "1,2,3");
+
+    for (auto bad : { "1,", ",1", "1,,2", "1;2", "1.5", "x", "99999999999" })
+	EXPECT_THROW(core::lexical_cast<List<int>>(bad), core::lexical_cast_error) << bad;
+
+    std::string input;
+    for (int i = 0; i < 100'000; ++i)
+	input += (i > 0 ? "," : "") + std::to_string(i);
+    auto values = core::lexical_cast<List<long>>(input);
+    ASSERT_EQ(values.size(), 100'000);
+    EXPECT_EQ(values[0], 0);
+    EXPECT_EQ(values[99'999], 99'999);
+}
+
+TEST(ArgParse, ListFloating)
+{
+    std::string input;
+    std::vector<double> expected;
+    for (int i = 0; i < 10'000; ++i)
+    {
+	auto field = std::to_string(i * 7919) + "." + std::to_string(i % 997);
+	if (i % 3 == 0) field = "-" + field;
+	if (i % 7 == 0) field += "e-3";
+	double value;
+	std::from_chars(field.data(), field.data() + field.size(), value);
+	expected.push_back(value);
+	input += (i > 0 ? "," : "") + field;
+    }
+    EXPECT_EQ(core::lexical_cast<List<double>>(input).values(), expected);
+    EXPECT_EQ(core::lexical_cast<List<float>>("0.1,12345678901234567890.5,inf"),
+	      (List<float>{ 0.1f, 12345678901234567890.5f, std::numeric_limits<float>::infinity() }));
+    EXPECT_THROW(core::lexical_cast<List<double>>("1.5.5"), core::lexical_cast_error);
+}
+
+TEST(ArgParse, ListWithSuffix)
+{
+    auto ints = core::lexical_cast<List<IntegerWithSuffix<long>>>("4k,0x10,2M");
+    ASSERT_EQ(ints.size(), 3);
+    EXPECT_EQ(ints[0], 4'000);
+    EXPECT_EQ(ints[1], 16);
+    EXPECT_EQ(ints[2], 2 * 1024 * 1024);
+
+    auto floats = core::lexical_cast<List<FloatingWithSuffix<double>>>("1.5k,2");
+    ASSERT_EQ(floats.size(), 2);
+    EXPECT_EQ(floats[0], 1500.0);
+    EXPECT_EQ(floats[1], 2.0);
+
+    EXPECT_THROW(core::lexical_cast<List<IntegerWithSuffix<int>>>("4k,4q"), core::lexical_cast_error);
+}
+
+TEST(ArgParse, ListOption)
+{
+    auto opts = ArgParse(argValue<'w', List<double>>("weights", "Weights"));
+    opts.parse({ "program", "--weights", "0.1,0.25,0.5" });
+    EXPECT_EQ(opts.get<'w'>(), (List<double>{ 0.1, 0.25, 0.5 }));
+    EXPECT_THROW(opts.parse({ "program", "-w", "0.1,x" }), core::argp::bad_value_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
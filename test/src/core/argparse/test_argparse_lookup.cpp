@@ -0,0 +1,86 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <map>
+#include "core/argparse/argp.h"
+
+using namespace core::argp::interface;
+
+TEST(ArgParse, Find)
+{
+    auto opts = ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose diagnostics"),
+	 argValue<'t', int>("threads", 4, "Number of threads"),
+	 argValues<'d', std::vector, double>("data", "Data"),
+	 argValues<'m', std::map<std::string, int>>("map", "Map"),
+	 argValues<'*', std::vector, std::string>("files", "Files", 0)
+	 );
+    opts.parse({ "program", "-v", "--data", "1.5", "2.5", "-m", "a=1", "b=2", "--", "x", "y" });
+
+    for (auto name : { "threads", "--threads", "-t", "t" })
+    {
+	auto view = opts.find(name);
+	ASSERT_TRUE(view) << name;
+	EXPECT_EQ(view->long_name(), "threads");
+	EXPECT_EQ(view->flag(), 't');
+	EXPECT_EQ(view->count(), 0);
+	EXPECT_TRUE(view->is<int>());
+	EXPECT_EQ(view->as<int>(), 4);
+	EXPECT_EQ(view->to_string(), "4");
+    }
+
+    EXPECT_FALSE(opts.find("thread"));
+    EXPECT_FALSE(opts.find("--t"));
+    EXPECT_FALSE(opts.find("-x"));
+    EXPECT_FALSE(opts.find(""));
+
+    auto data = opts.find("data");
+    EXPECT_EQ(data->as<std::vector<double>>(), (std::vector<double>{ 1.5, 2.5 }));
+    EXPECT_EQ(data->get_if<std::vector<int>>(), nullptr);
+    EXPECT_THROW(data->as<std::vector<int>>(), std::bad_cast);
+    EXPECT_EQ(opts.find("verbose")->to_string(), "true");
+    EXPECT_EQ(opts.find("map")->to_string(), "a=1 b=2");
+    EXPECT_EQ(opts.find("*")->to_string(), "x y");
+    EXPECT_EQ(opts.find("files")->count(), 1);
+}
+
+TEST(ArgParse, FindManyOptions)
+{
+    auto opts = ArgParse
+	(
+	 argValue<'a', int>("alpha", "A"), argValue<'b', int>("beta", "B"),
+	 argValue<'c', int>("gamma", "C"), argValue<'d', int>("delta", "D"),
+	 argValue<'e', int>("epsilon", "E"), argValue<'f', int>("zeta", "F"),
+	 argValue<'g', int>("eta", "G"), argValue<'h', int>("theta", "H")
+	 );
+    opts.parse({ "program", "--eta", "7", "--theta", "8", "--alpha", "1" });
+    for (auto name : { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta" })
+	EXPECT_EQ(opts.find(name)->long_name(), name);
+    EXPECT_EQ(opts.get<'g'>(), 7);
+    EXPECT_THROW(opts.parse({ "program", "--iota", "1" }), core::argp::unknown_option_error);
+}
+
+TEST(ArgParse, PresentOptions)
+{
+    auto opts = ArgParse
+	(
+	 argFlag<'v'>("verbose", "Verbose diagnostics"),
+	 argValue<'t', int>("threads", 4, "Number of threads"),
+	 argValue<'o', std::string>("output", "Output file")
+	 );
+    opts.parse({ "program", "-o", "out.txt", "-vv" });
+
+    std::vector<std::string> seen;
+    for (auto view : opts.present())
+	seen.push_back(std::string(view.long_name()) + ":" + std::to_string(view.count())
+		       + ":" + view.to_string());
+    EXPECT_EQ(seen, (std::vector<std::string>{ "verbose:2:true", "output:1:out.txt" }));
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
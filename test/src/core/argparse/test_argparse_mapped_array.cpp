@@ -0,0 +1,68 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <vector>
+#include "core/argparse/argp.h"
+#include "core/argparse/mapped_array.h"
+
+using namespace core::argp::interface;
+
+static std::string write_file(const std::string& name, const void *data, size_t size)
+{
+    auto path = testing::TempDir() + name;
+    std::ofstream ofs(path, std::ios::binary);
+    ofs.write(static_cast<const char*>(data), size);
+    return path;
+}
+
+TEST(ArgParse, MappedArray)
+{
+    std::vector<double> weights{ 0.5, 1.5, 2.5 };
+    auto path = write_file("weights.f64", weights.data(), weights.size() * sizeof(double));
+
+    auto array = core::lexical_cast<MappedArray<double>>("@" + path);
+    EXPECT_EQ(array.size(), 3);
+    EXPECT_TRUE(std::equal(array.begin(), array.end(), weights.begin(), weights.end()));
+    EXPECT_EQ(core::lexical_to_string(array), "@" + path);
+
+    ArgParse opts(argValue<'w'>("weights", MappedArray<double>{}, "Weights"));
+    opts.parse({"program", "--weights", "@" + path});
+    auto values = opts.get<'w'>();
+    EXPECT_EQ(values.size(), 3);
+    EXPECT_EQ(values[1], 1.5);
+    std::remove(path.c_str());
+}
+
+TEST(ArgParse, MappedArrayEmpty)
+{
+    auto path = write_file("empty.f64", nullptr, 0);
+    auto array = core::lexical_cast<MappedArray<double>>("@" + path);
+    EXPECT_TRUE(array.empty());
+    std::remove(path.c_str());
+}
+
+TEST(ArgParse, MappedArrayErrors)
+{
+    char bytes[5]{};
+    auto path = write_file("odd.f64", bytes, sizeof(bytes));
+
+    using Array = MappedArray<double>;
+    EXPECT_THROW(core::lexical_cast<Array>(path), core::lexical_cast_error);
+    EXPECT_THROW(core::lexical_cast<Array>("@" + path), core::lexical_cast_error);
+    EXPECT_THROW(core::lexical_cast<Array>("@" + path + ".missing"), core::lexical_cast_error);
+    EXPECT_THROW(core::lexical_cast<Array>("@" + testing::TempDir()), core::lexical_cast_error);
+    EXPECT_NO_THROW(core::lexical_cast<MappedArray<char>>("@" + path));
+
+    ArgParse opts(argValue<'w'>("weights", Array{}, "Weights"));
+    EXPECT_THROW(opts.parse({"program", "-w", "@" + path}), core::argp::bad_value_error);
+    std::remove(path.c_str());
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+#include "core/argparse/argp.h"
+#include "core/argparse/path.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+namespace fs = std::filesystem;
+
+class PathTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+	dir = fs::temp_directory_path() / ("argparse_path_" + std::to_string(::getpid()));
+	fs::create_directories(dir);
+	for (int i = 0; i < 100; ++i)
+	{
+	    files.push_back((dir / ("file" + std::to_string(i))).string());
+	    std::ofstream(files.back()) << std::string(i, 'x');
+	}
+    }
+
+    void TearDown() override
+    { fs::remove_all(dir); }
+
+    fs::path dir;
+    std::vector<std::string> files;
+};
+
+using InputPath = Path<PathCheck::File | PathCheck::Readable | PathCheck::Open>;
+
+TEST_F(PathTest, Prefetch)
+{
+    auto opts = ArgParse
+	(
+	 argValue<'d',Path<PathCheck::Directory>>("dir", "Directory"),
+	 argValues<'*',std::vector<InputPath>>("files", "Files")
+	 );
+    
+    std::vector<std::string> args{ "program", "-d", dir.string() };
+    args.insert(args.end(), files.begin(), files.end());
+    opts.parse(args);
+
+    EXPECT_EQ(opts.get<'d'>().path(), dir.string());
+    EXPECT_EQ(opts.get<'d'>().fd(), -1);
+    
+    const auto& paths = opts.get<'*'>();
+    ASSERT_EQ(paths.size(), files.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+	EXPECT_EQ(paths[i].path(), files[i]);
+	EXPECT_EQ(paths[i].size(), i);
+	EXPECT_GE(paths[i].fd(), 0);
+	char c{};
+	EXPECT_EQ(::pread(paths[i].fd(), &c, 1, 0), i > 0 ? 1 : 0);
+    }
+}
+
+TEST_F(PathTest, Errors)
+{
+    auto opts = ArgParse(argValues<'*',std::vector<InputPath>>("files", "Files"));
+    
+    auto missing = (dir / "missing").string();
+    std::vector<std::string> args{ "program", files[0], files[1], missing, files[2] };
+    try
+    {
+	opts.parse(args);
+	FAIL() << "missing file accepted";
+    }
+    catch (const argp::bad_value_error& error)
+    {
+	EXPECT_EQ(error.context.front(), missing);
+    }
+
+    EXPECT_THROW(opts.parse({ "program", dir.string() }), argp::bad_value_error);
+    EXPECT_THROW(core::lexical_cast<Path<PathCheck::Directory>>(files[0]), core::lexical_cast_error);
+    EXPECT_EQ(core::lexical_cast<Path<>>(files[0]).path(), files[0]);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include "core/argparse/argp.h"
+#include "core/argparse/range_set.h"
+#include "core/mp/foreach.h"
+
+using namespace core::argp::interface;
+
+TEST(ArgParse, RangeSet)
+{
+    auto test = []<class T>() {
+	auto set = core::lexical_cast<RangeSet<T>>("20-30:5,0-9:4,12");
+	EXPECT_EQ(set.size(), 7);
+	EXPECT_EQ(std::vector<T>(set.begin(), set.end()), (std::vector<T>{0, 4, 8, 12, 20, 25, 30}));
+	EXPECT_EQ(set[3], 12);
+	EXPECT_EQ(set[6], 30);
+	EXPECT_TRUE(set.contains(8));
+	EXPECT_TRUE(set.contains(25));
+	EXPECT_FALSE(set.contains(9));
+	EXPECT_FALSE(set.contains(31));
+	EXPECT_EQ(core::lexical_to_string(set), "0-8:4,12,20-30:5");
+	EXPECT_EQ(core::lexical_cast<RangeSet<T>>(core::lexical_to_string(set)), set);
+	
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>(""), core::lexical_cast_error);
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>("5-1"), core::lexical_cast_error);
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>("1-5:0"), core::lexical_cast_error);
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>("1-5,5-9"), core::lexical_cast_error);
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>("1-5,"), core::lexical_cast_error);
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>("1-5x"), core::lexical_cast_error);
+	EXPECT_THROW(core::lexical_cast<RangeSet<T>>("1-99999999999999999999"), core::lexical_cast_error);
+    };
+    core::mp::foreach<int, unsigned int, long, unsigned long>(test);
+}
+
+TEST(ArgParse, RangeSetSigned)
+{
+    auto set = core::lexical_cast<RangeSet<int>>("-10--4:3,-1");
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), (std::vector<int>{-10, -7, -4, -1}));
+
+    auto full = core::lexical_cast<RangeSet<long>>("-9223372036854775807-9223372036854775807:2");
+    EXPECT_EQ(full.size(), 9223372036854775807ul + 1);
+    EXPECT_TRUE(full.contains(1));
+    EXPECT_FALSE(full.contains(0));
+}
+
+TEST(ArgParse, RangeSetChunk)
+{
+    auto set = core::lexical_cast<RangeSet<int>>("0-99999:4,200000-300000");
+    EXPECT_EQ(set.size(), 25000 + 100001);
+
+    auto chunks = set.split(7);
+    size_t total{0};
+    std::vector<int> joined;
+    for (const auto& chunk : chunks)
+    {
+	EXPECT_LE(chunk.size() - set.size() / 7, 1);
+	total += chunk.size();
+	joined.insert(joined.end(), chunk.begin(), chunk.end());
+    }
+    EXPECT_EQ(total, set.size());
+    EXPECT_TRUE(std::equal(joined.begin(), joined.end(), set.begin(), set.end()));
+    EXPECT_TRUE(set.slice(set.size(), 10).empty());
+    EXPECT_THROW(set.split(0), std::invalid_argument);
+    EXPECT_THROW(set.chunk(0, 0), std::invalid_argument);
+}
+
+TEST(ArgParse, RangeSetOption)
+{
+    ArgParse opts(argValue<'s'>("shards", RangeSet<int>{}, "Shards"));
+    opts.parse({"program", "--shards", "0-9:2,20"});
+    EXPECT_EQ(opts.get<'s'>().size(), 6);
+    ASSERT_THROW(opts.parse({"program", "-s", "3-1"}), core::argp::bad_value_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
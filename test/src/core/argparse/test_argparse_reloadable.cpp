@@ -0,0 +1,92 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "core/argparse/argp.h"
+#include "core/argparse/reloadable.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+
+static auto make_parser()
+{
+    return ArgParse
+	(
+	 argValue<'a',int>("alpha", "Alpha"),
+	 argValue<'b',int>("beta", "Beta")
+	 );
+}
+
+static std::vector<std::string> make_args(int n)
+{ return { "program", "-a", std::to_string(n), "-b", std::to_string(n) }; }
+
+TEST(ArgParse, Reloadable)
+{
+    argp::Reloadable options(make_parser, make_args(0));
+    auto reader = options.reader();
+    {
+	auto snapshot = reader.snapshot();
+	EXPECT_EQ(snapshot->get<'a'>(), 0);
+
+	options.reload(make_args(1));
+	EXPECT_EQ(snapshot->get<'a'>(), 0);
+	EXPECT_EQ(options.retired(), 1);
+    }
+    EXPECT_EQ(reader.snapshot()->get<'b'>(), 1);
+
+    options.reload(make_args(2));
+    EXPECT_EQ(options.retired(), 0);
+    
+    EXPECT_THROW(options.reload({"program", "-a", "x"}), argp::bad_value_error);
+    EXPECT_EQ(reader.snapshot()->get<'a'>(), 2);
+}
+
+TEST(ArgParse, ReloadableConcurrent)
+{
+    argp::Reloadable options(make_parser, make_args(0));
+    std::atomic<bool> done{false};
+    std::atomic<size_t> inconsistent{0};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i)
+	threads.emplace_back([&]() {
+	    auto reader = options.reader();
+	    int last{0};
+	    while (not done.load())
+	    {
+		auto snapshot = reader.snapshot();
+		auto a = snapshot->get<'a'>(), b = snapshot->get<'b'>();
+		if (a != b or a < last)
+		    ++inconsistent;
+		last = a;
+	    }
+	});
+
+    for (int n = 1; n <= 500; ++n)
+	options.reload(make_args(n));
+    done = true;
+    for (auto& thread : threads)
+	thread.join();
+
+    EXPECT_EQ(inconsistent, 0);
+    options.reload(make_args(501));
+    EXPECT_EQ(options.retired(), 0);
+}
+
+TEST(ArgParse, ReloadableSignal)
+{
+    argp::Reloadable options(make_parser, make_args(0));
+    argp::install_reload_signal(SIGHUP);
+    EXPECT_FALSE(options.poll(make_args(1)));
+    std::raise(SIGHUP);
+    EXPECT_TRUE(options.poll(make_args(1)));
+    EXPECT_FALSE(options.poll(make_args(2)));
+    EXPECT_EQ(options.reader().snapshot()->get<'a'>(), 1);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
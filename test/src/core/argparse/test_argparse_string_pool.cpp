@@ -0,0 +1,124 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+#include "core/argparse/argp.h"
+#include "core/argparse/string_pool.h"
+
+using namespace core::argp::interface;
+
+TEST(ArgParse, StringPool)
+{
+    StringPool pool;
+    EXPECT_TRUE(pool.empty());
+    pool.push_back("alpha");
+    pool.push_back("");
+    pool.push_back("gamma");
+    EXPECT_EQ(pool.size(), 3);
+    EXPECT_EQ(pool[0], "alpha");
+    EXPECT_EQ(pool[1], "");
+    EXPECT_EQ(pool[2], "gamma");
+    EXPECT_EQ(pool.chars(), "alphagamma");
+    EXPECT_EQ(std::vector<std::string_view>(pool.begin(), pool.end()),
+	      (std::vector<std::string_view>{ "alpha", "", "gamma" }));
+    EXPECT_EQ(pool.end() - pool.begin(), 3);
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+}
+
+TEST(ArgParse, StringTable)
+{
+    StringTable table;
+    for (int i = 0; i < 1000; ++i)
+	table.push_back("file" + std::to_string(i % 10));
+    EXPECT_EQ(table.size(), 1000);
+    EXPECT_EQ(table.unique().size(), 10);
+    EXPECT_EQ(table[17], "file7");
+    EXPECT_EQ(table.id(17), table.id(7));
+    EXPECT_NE(table.id(17), table.id(8));
+    EXPECT_LT(table.bytes(), 1000 * sizeof(uint32_t) + 512);
+}
+
+TEST(ArgParse, StringPoolArgValues)
+{
+    size_t calls{0};
+    auto opts = ArgParse
+	(
+	 argValues<'x',StringTable>("names", "Names"),
+	 argValuesApply<'*',StringPool>("files", "Files", [&](std::string_view) { ++calls; })
+	 );
+    opts.parse({ "program", "-x", "a", "b", "a", "--", "one", "two" });
+    EXPECT_EQ(std::vector<std::string_view>(opts.get<'x'>().begin(), opts.get<'x'>().end()),
+	      (std::vector<std::string_view>{ "a", "b", "a" }));
+    EXPECT_EQ(opts.get<'x'>().unique().size(), 2);
+    EXPECT_EQ(opts.get<'*'>()[1], "two");
+    EXPECT_EQ(calls, 2);
+
+    auto path = (std::filesystem::temp_directory_path()
+		 / ("argparse_string_pool_" + std::to_string(::getpid()))).string();
+    std::vector<std::string> args{ "program", "-x", "a", "b", "a", "--", "one", "two" };
+    auto first = ArgParse(argValues<'x',StringTable>("names", "Names"),
+			  argValues<'*',StringPool>("files", "Files"));
+    EXPECT_FALSE(first.parse_cached(path, args));
+    auto second = ArgParse(argValues<'x',StringTable>("names", "Names"),
+			   argValues<'*',StringPool>("files", "Files"));
+    EXPECT_TRUE(second.parse_cached(path, args));
+    EXPECT_EQ(second.get<'x'>(), first.get<'x'>());
+    EXPECT_EQ(second.get<'*'>(), first.get<'*'>());
+    std::filesystem::remove(path);
+}
+
+// Overwrite the 64-bit field at `offset` in the payload of the cache at
+// `path` and recompute its FNV-1a checksum, as a crafted cache would.
+static void forge(const std::string& path, size_t offset, uint64_t field)
+{
+    constexpr size_t HeaderSize = 40, ChecksumOffset = 32;
+    std::string bytes;
+    {
+	std::ifstream file(path, std::ios::binary);
+	bytes.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    ASSERT_GE(bytes.size(), HeaderSize + offset + sizeof(field));
+    std::memcpy(bytes.data() + HeaderSize + offset, &field, sizeof(field));
+
+    uint64_t checksum{0xcbf29ce484222325ull};
+    for (size_t i = HeaderSize; i < bytes.size(); ++i)
+	checksum = (checksum ^ static_cast<unsigned char>(bytes[i])) * 0x100000001b3ull;
+    std::memcpy(bytes.data() + ChecksumOffset, &checksum, sizeof(checksum));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+}
+
+TEST(ArgParse, StringPoolForgedCacheFallsBack)
+{
+    auto path = (std::filesystem::temp_directory_path()
+		 / ("argparse_string_pool_forged_" + std::to_string(::getpid()))).string();
+    std::vector<std::string> args{ "program", "one", "two" };
+    auto make = []() { return ArgParse(argValues<'*',StringPool>("files", "Files")); };
+
+    // The payload holds the occurrence count, the number of strings and
+    // then the length of the first string.
+    for (auto [offset, field] : { std::pair<size_t, uint64_t>{ 8, uint64_t{1} << 61 },
+				  { 8, uint64_t{1} << 33 },
+				  { 16, uint64_t{1} << 61 },
+				  { 16, 4 } })
+    {
+	std::filesystem::remove(path);
+	auto first = make();
+	EXPECT_FALSE(first.parse_cached(path, args));
+	forge(path, offset, field);
+	auto forged = make();
+	EXPECT_FALSE(forged.parse_cached(path, args));
+	EXPECT_EQ(forged.get<'*'>(), first.get<'*'>());
+    }
+    std::filesystem::remove(path);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2026 by Mark Melton
+//
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <random>
+#include "core/argparse/argp.h"
+#include "core/argparse/detail/message.h"
+#include "core/argparse/detail/suggest.h"
+
+using namespace core::argp::interface;
+namespace argp = core::argp;
+
+static size_t reference_distance(std::string_view a, std::string_view b)
+{
+    std::vector<std::vector<size_t>> d(a.size() + 1, std::vector<size_t>(b.size() + 1));
+    for (size_t i = 0; i <= a.size(); ++i) d[i][0] = i;
+    for (size_t j = 0; j <= b.size(); ++j) d[0][j] = j;
+    for (size_t i = 1; i <= a.size(); ++i)
+	for (size_t j = 1; j <= b.size(); ++j)
+	    d[i][j] = std::min({ d[i-1][j] + 1, d[i][j-1] + 1, d[i-1][j-1] + (a[i-1] != b[j-1]) });
+    return d[a.size()][b.size()];
+}
+
+TEST(ArgParse, EditDistance)
+{
+    EXPECT_EQ(argp::edit_distance("", ""), 0);
+    EXPECT_EQ(argp::edit_distance("abc", ""), 3);
+    EXPECT_EQ(argp::edit_distance("kitten", "sitting"), 3);
+    EXPECT_EQ(argp::edit_distance("verbose", "verbsoe"), 2);
+    
+    std::mt19937 rng(42);
+    auto random_string = [&](size_t max_size) {
+	std::string s(std::uniform_int_distribution<size_t>(0, max_size)(rng), ' ');
+	for (auto& c : s) c = "abcd"[rng() % 4];
+	return s;
+    };
+    for (size_t i = 0; i < 2000; ++i)
+    {
+	auto a = random_string(i % 2 ? 20 : 100), b = random_string(80);
+	EXPECT_EQ(argp::edit_distance(a, b), reference_distance(a, b)) << a << " " << b;
+    }
+}
+
+TEST(ArgParse, Suggest)
+{
+    std::vector<std::string_view> names{ "verbose", "version", "output", "format", "threads" };
+    EXPECT_EQ(argp::suggest("verbos", names), (std::vector<std::string>{ "verbose", "version" }));
+    EXPECT_EQ(argp::suggest("ouptut", names), (std::vector<std::string>{ "output" }));
+    EXPECT_TRUE(argp::suggest("zzz", names).empty());
+    EXPECT_TRUE(argp::suggest(std::string(10000, 'v'), names).empty());
+}
+
+TEST(ArgParse, UnknownOptionSuggestion)
+{
+    ArgParse opts
+	(
+	 argFlag<'v'>("verbose", "Verbose"),
+	 argValue<'t',int>("threads", "Threads")
+	 );
+    try
+    {
+	opts.parse({"program", "--thread=4"});
+	FAIL();
+    }
+    catch (const argp::unknown_option_error& e)
+    {
+	EXPECT_EQ(e.suggestions, (std::vector<std::string>{ "threads" }));
+	EXPECT_EQ(std::string(e.what()), fmt::format(argp::unknown_option_msg, "--thread")
+		  + fmt::format(argp::suggestion_msg, "'--threads'"));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}